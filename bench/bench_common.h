@@ -0,0 +1,347 @@
+#ifndef DAEDALUS_BENCH_BENCH_COMMON_H
+#define DAEDALUS_BENCH_BENCH_COMMON_H
+
+/**
+ * @brief Command line parsing, timing, and CSV/JSON output shared by the benchmarks. Each benchmark keeps its own
+ * settings and result structs, and only describes them here.
+ */
+
+#include "daedalus/profiling/timer.h"
+#include "daedalus/program/meta.h"
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace dae::bench
+{
+constexpr double BYTES_PER_GB = 1'000'000'000.0;
+constexpr double MICROSECONDS_PER_SECOND = 1'000'000.0;
+
+/**
+ * @brief Parses a whole string as an unsigned number.
+ *
+ * @return Nothing if the string is not entirely a number.
+ */
+inline auto parse_number(std::string_view text) -> std::optional<uint64_t>
+{
+    uint64_t value = 0;
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc() || end != text.data() + text.size())
+    {
+        return std::nullopt;
+    }
+    return value;
+}
+
+/**
+ * @brief The command line options of a benchmark. Each option writes into a field of the benchmark's own settings,
+ * which keeps its default when the option is not given.
+ */
+class Options
+{
+  public:
+    explicit Options(std::string_view program) : program(program)
+    {
+    }
+
+    /**
+     * @brief An option without a value, which sets `value` to true.
+     */
+    auto flag(std::string_view name, bool& value) -> Options&
+    {
+        options.push_back({.name = name, .placeholder = {}, .target = &value});
+        return *this;
+    }
+
+    /**
+     * @brief An option followed by a number, which must not be zero.
+     *
+     * @param placeholder What the value is called in the usage, such as "BYTES".
+     */
+    auto number(std::string_view name, std::string_view placeholder, uint64_t& value) -> Options&
+    {
+        options.push_back({.name = name, .placeholder = placeholder, .target = &value});
+        return *this;
+    }
+
+    auto number(std::string_view name, std::string_view placeholder, uint32_t& value) -> Options&
+    {
+        options.push_back({.name = name, .placeholder = placeholder, .target = &value});
+        return *this;
+    }
+
+    /**
+     * @brief An option followed by a path.
+     */
+    auto path(std::string_view name, std::string_view placeholder, std::filesystem::path& value) -> Options&
+    {
+        options.push_back({.name = name, .placeholder = placeholder, .target = &value});
+        return *this;
+    }
+
+    /**
+     * @brief Parses the command line, and prints the usage to stderr if any of it is not a known option.
+     *
+     * @return False if the command line was not valid.
+     */
+    [[nodiscard]] auto parse(int argc, char** argv) const -> bool
+    {
+        const std::vector<std::string_view> args = dae::parse_args(argc, argv);
+        for (size_t i = 1; i < args.size(); i++)
+        {
+            const Option* option = find(args[i]);
+            if (option == nullptr || !set(*option, args, i))
+            {
+                print_usage();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    auto print_usage() const -> void
+    {
+        std::string usage = "usage: " + std::string(program);
+        for (const Option& option : options)
+        {
+            usage += " [" + std::string(option.name);
+            if (!option.placeholder.empty())
+            {
+                usage += " " + std::string(option.placeholder);
+            }
+            usage += "]";
+        }
+        std::fprintf(stderr, "%s\n", usage.c_str());
+    }
+
+  private:
+    struct Option
+    {
+        std::string_view name;
+        std::string_view placeholder;
+        std::variant<bool*, uint32_t*, uint64_t*, std::filesystem::path*> target;
+    };
+
+    [[nodiscard]] auto find(std::string_view name) const -> const Option*
+    {
+        auto it = std::ranges::find(options, name, &Option::name);
+        return it != options.end() ? &*it : nullptr;
+    }
+
+    /**
+     * @brief Sets an option's field, from the argument after it if it takes a value.
+     *
+     * @param i The index of the option's name, moved past its value.
+     */
+    static auto set(const Option& option, const std::vector<std::string_view>& args, size_t& i) -> bool
+    {
+        if (bool* const* flag = std::get_if<bool*>(&option.target))
+        {
+            **flag = true;
+            return true;
+        }
+        if (i + 1 >= args.size())
+        {
+            return false;
+        }
+        const std::string_view text = args[++i];
+
+        if (std::filesystem::path* const* path = std::get_if<std::filesystem::path*>(&option.target))
+        {
+            **path = text;
+            return true;
+        }
+
+        std::optional<uint64_t> value = parse_number(text);
+        if (!value || value.value() == 0)
+        {
+            return false;
+        }
+        if (uint32_t* const* small = std::get_if<uint32_t*>(&option.target))
+        {
+            **small = static_cast<uint32_t>(value.value());
+        }
+        else
+        {
+            *std::get<uint64_t*>(option.target) = value.value();
+        }
+        return true;
+    }
+
+    std::string_view program;
+    std::vector<Option> options;
+};
+
+/**
+ * @brief The latencies of a number of iterations, in microseconds.
+ */
+struct Timings
+{
+    double min_us{0.0};
+    double median_us{0.0};
+    double mean_us{0.0};
+    double max_us{0.0};
+};
+
+/**
+ * @brief Times a function over a number of iterations.
+ *
+ * @param prepare Called before each iteration, outside of the timing.
+ */
+template <typename Prepare, typename Run>
+auto time_iterations(uint32_t iterations, Prepare&& prepare, Run&& run) -> Timings
+{
+    std::vector<double> latencies_us;
+    latencies_us.reserve(iterations);
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        prepare();
+        dae::Resettable timer;
+        run();
+        latencies_us.push_back(timer.getMicroseconds());
+    }
+
+    std::ranges::sort(latencies_us);
+    double total_us = 0.0;
+    for (double latency_us : latencies_us)
+    {
+        total_us += latency_us;
+    }
+
+    return Timings{
+        .min_us = latencies_us.front(),
+        .median_us = latencies_us[latencies_us.size() / 2],
+        .mean_us = total_us / static_cast<double>(latencies_us.size()),
+        .max_us = latencies_us.back(),
+    };
+}
+
+template <typename Run>
+auto time_iterations(uint32_t iterations, Run&& run) -> Timings
+{
+    return time_iterations(iterations, []() -> void {}, run);
+}
+
+/**
+ * @brief Converts processing `bytes` in `us` microseconds to GB/s, or 0 if the time was too short to measure.
+ */
+inline auto gb_per_second(uint64_t bytes, double us) -> double
+{
+    return us > 0.0 ? (static_cast<double>(bytes) / BYTES_PER_GB) / (us / MICROSECONDS_PER_SECOND) : 0.0;
+}
+
+/**
+ * @brief A named value in a row of output. Numbers are written as integers, or with three decimal places.
+ */
+class Column
+{
+  public:
+    Column(std::string_view name, std::string_view text) : name(name), value(text)
+    {
+    }
+
+    template <std::integral T>
+    Column(std::string_view name, T number) : name(name), value(static_cast<uint64_t>(number))
+    {
+    }
+
+    Column(std::string_view name, double number) : name(name), value(number)
+    {
+    }
+
+    [[nodiscard]] auto get_name() const -> std::string_view
+    {
+        return name;
+    }
+
+    /**
+     * @brief Writes the value to stdout, with text in quotes if `quoted`.
+     */
+    auto print(bool quoted) const -> void
+    {
+        if (const std::string_view* text = std::get_if<std::string_view>(&value))
+        {
+            std::printf(quoted ? "\"%.*s\"" : "%.*s", static_cast<int>(text->size()), text->data());
+        }
+        else if (const uint64_t* integer = std::get_if<uint64_t>(&value))
+        {
+            std::printf("%llu", static_cast<unsigned long long>(*integer));
+        }
+        else
+        {
+            std::printf("%.3f", std::get<double>(value));
+        }
+    }
+
+  private:
+    std::string_view name;
+    std::variant<std::string_view, uint64_t, double> value;
+};
+
+/**
+ * @brief Writes results to stdout, as CSV with a header, or as a JSON array of objects.
+ *
+ * @param columns Returns the `Column`s of a result, in the same order for every result.
+ */
+template <typename Result, typename Columns>
+auto print_results(const std::vector<Result>& results, bool json, Columns&& columns) -> void
+{
+    if (json)
+    {
+        std::printf("[\n");
+    }
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const std::vector<Column> row = columns(results[i]);
+        if (!json && i == 0)
+        {
+            for (size_t c = 0; c < row.size(); c++)
+            {
+                std::printf(c == 0 ? "%.*s" : ",%.*s",
+                            static_cast<int>(row[c].get_name().size()),
+                            row[c].get_name().data());
+            }
+            std::printf("\n");
+        }
+
+        if (json)
+        {
+            std::printf("  {");
+        }
+        for (size_t c = 0; c < row.size(); c++)
+        {
+            if (c != 0)
+            {
+                std::printf(json ? ", " : ",");
+            }
+            if (json)
+            {
+                std::printf("\"%.*s\": ",
+                            static_cast<int>(row[c].get_name().size()),
+                            row[c].get_name().data());
+            }
+            row[c].print(json);
+        }
+        if (json)
+        {
+            std::printf(i + 1 < results.size() ? "}," : "}");
+        }
+        std::printf("\n");
+    }
+    if (json)
+    {
+        std::printf("]\n");
+    }
+}
+} // namespace dae::bench
+
+#endif
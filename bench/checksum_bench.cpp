@@ -0,0 +1,284 @@
+/**
+ * @brief Benchmarks the CRC32C kernels against a byte-at-a-time table implementation, and checksummed loads against
+ * loading a file and checksumming it afterwards.
+ *
+ * Usage: daedalus_checksum_bench [--dir DIR] [--max-size BYTES] [--iterations N] [--json] [--keep]
+ *
+ * Results are written to stdout as CSV (or JSON with --json), one row per implementation, cache state, and size.
+ * Progress is written to stderr.
+ */
+
+#include "daedalus/core/cpu.h"
+#include "daedalus/io/cache.h"
+#include "daedalus/io/checksum.h"
+#include "daedalus/io/file.h"
+
+#include "bench_common.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+using dae::io::File;
+using dae::io::FileLoadStrategy;
+
+constexpr uint64_t MIN_SIZE = 64;
+
+/**
+ * @brief Settings parsed from the command line.
+ */
+struct BenchOptions
+{
+    std::filesystem::path directory{std::filesystem::temp_directory_path() / "daedalus_checksum_bench"};
+    uint64_t max_size{static_cast<uint64_t>(64) * 1024 * 1024};
+    uint32_t iterations{5};
+    bool json{false};
+    bool keep{false};
+};
+
+/**
+ * @brief A single row of output.
+ */
+struct BenchResult
+{
+    std::string_view implementation;
+    std::string_view cache;
+    uint64_t size{0};
+    uint32_t iterations{0};
+    uint32_t failures{0};
+    double min_us{0.0};
+    double median_us{0.0};
+    double mean_us{0.0};
+    double throughput_gb_s{0.0};
+};
+
+/**
+ * @brief The classic byte-at-a-time table implementation (Sarwate), as a baseline for the kernels.
+ */
+auto crc32c_bytewise(std::span<const std::byte> data) -> uint32_t
+{
+    static const std::array<uint32_t, 256> table = []() -> std::array<uint32_t, 256> {
+        std::array<uint32_t, 256> t{};
+        for (uint32_t i = 0; i < t.size(); i++)
+        {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                crc = (crc >> 1) ^ ((crc & 1) != 0 ? 0x82F63B78 : 0);
+            }
+            t[i] = crc;
+        }
+        return t;
+    }();
+
+    uint32_t crc = ~uint32_t{0};
+    for (std::byte byte : data)
+    {
+        crc = (crc >> 8) ^ table[(crc ^ static_cast<uint32_t>(byte)) & 0xFF];
+    }
+    return ~crc;
+}
+
+/**
+ * @brief Times a function over a number of iterations.
+ *
+ * @param prepare Called before each iteration, outside of the timing.
+ * @param run Returns false if the iteration failed.
+ */
+template <typename Prepare, typename Run>
+auto measure(std::string_view implementation,
+             std::string_view cache,
+             uint64_t size,
+             uint32_t iterations,
+             Prepare&& prepare,
+             Run&& run) -> BenchResult
+{
+    BenchResult result{
+        .implementation = implementation,
+        .cache = cache,
+        .size = size,
+        .iterations = iterations,
+    };
+
+    const dae::bench::Timings timings = dae::bench::time_iterations(iterations, prepare, [&]() -> void {
+        if (!run())
+        {
+            result.failures++;
+        }
+    });
+    result.min_us = timings.min_us;
+    result.median_us = timings.median_us;
+    result.mean_us = timings.mean_us;
+    result.throughput_gb_s = dae::bench::gb_per_second(size, timings.median_us);
+    return result;
+}
+
+/**
+ * @brief Loads a file and checksums it in a second pass, as a baseline for `load_file_checked()`.
+ */
+auto load_then_checksum(const std::string& path, FileLoadStrategy strategy, uint32_t expected) -> bool
+{
+    std::optional<File> file = dae::io::load_file(path, strategy);
+    if (!file)
+    {
+        return false;
+    }
+    const bool matches = dae::io::crc32c(dae::io::get_file_data(file.value())) == expected;
+    dae::io::free_file(file.value());
+    return matches;
+}
+
+auto load_checked(const std::string& path, FileLoadStrategy strategy, uint32_t expected) -> bool
+{
+    std::optional<File> file = dae::io::load_file_checked(path, expected, strategy);
+    if (!file)
+    {
+        return false;
+    }
+    dae::io::free_file(file.value());
+    return true;
+}
+
+auto columns(const BenchResult& r) -> std::vector<dae::bench::Column>
+{
+    return {
+        {"implementation", r.implementation},
+        {"cache", r.cache},
+        {"size_bytes", r.size},
+        {"iterations", r.iterations},
+        {"failures", r.failures},
+        {"min_us", r.min_us},
+        {"median_us", r.median_us},
+        {"mean_us", r.mean_us},
+        {"throughput_gb_s", r.throughput_gb_s},
+    };
+}
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    BenchOptions options;
+    const bool parsed = dae::bench::Options("daedalus_checksum_bench")
+                            .path("--dir", "DIR", options.directory)
+                            .number("--max-size", "BYTES", options.max_size)
+                            .number("--iterations", "N", options.iterations)
+                            .flag("--json", options.json)
+                            .flag("--keep", options.keep)
+                            .parse(argc, argv);
+    if (!parsed)
+    {
+        return 1;
+    }
+    options.max_size = std::max(options.max_size, MIN_SIZE);
+
+    const dae::CpuFeatures& features = dae::get_cpu_features();
+    std::fprintf(stderr,
+                 "hardware crc32c: %s\n",
+                 features.sse42 ? "sse4.2" : (features.arm_crc32 ? "arm crc" : "none"));
+
+    std::mt19937_64 random(0xDAEDA105);
+    std::vector<std::byte> data(options.max_size);
+    for (std::byte& byte : data)
+    {
+        byte = static_cast<std::byte>(random());
+    }
+
+    std::vector<BenchResult> results;
+    auto nothing = []() -> void {};
+
+    // Kernels over data that is already in memory, sweeping up by 16x
+    for (uint64_t size = MIN_SIZE; size <= options.max_size; size *= 16)
+    {
+        const std::span<const std::byte> block(data.data(), size);
+        const uint32_t expected = dae::io::crc32c_portable(block);
+        std::fprintf(stderr, "kernels %llu bytes\n", static_cast<unsigned long long>(size));
+
+        results.push_back(measure("crc32c", "memory", size, options.iterations, nothing, [&]() -> bool {
+            return dae::io::crc32c(block) == expected;
+        }));
+        results.push_back(measure("crc32c_portable", "memory", size, options.iterations, nothing, [&]() -> bool {
+            return dae::io::crc32c_portable(block) == expected;
+        }));
+        results.push_back(measure("bytewise_table", "memory", size, options.iterations, nothing, [&]() -> bool {
+            return crc32c_bytewise(block) == expected;
+        }));
+    }
+
+    // Checksummed loads of the largest size, against loading and then checksumming
+    std::error_code error;
+    std::filesystem::create_directories(options.directory, error);
+    const std::filesystem::path path = options.directory / "checksum_bench";
+    if (error || !dae::io::save_file(path.string(), data))
+    {
+        std::fprintf(stderr, "could not write %s\n", path.string().c_str());
+        return 1;
+    }
+    const std::string file = path.string();
+    const uint32_t expected = dae::io::crc32c(data);
+
+    const bool can_evict = dae::io::evict_file(file);
+    if (!can_evict)
+    {
+        std::fprintf(stderr, "evicting files from the cache is not supported here, skipping cold runs\n");
+    }
+
+    struct FileBench
+    {
+        std::string_view name;
+        FileLoadStrategy strategy;
+        bool checked;
+    };
+    const std::array<FileBench, 4> file_benches{{
+        {"AllowCached+crc32c", FileLoadStrategy::AllowCached, false},
+        {"AllowCached checked", FileLoadStrategy::AllowCached, true},
+        {"SafeDirectDisk+crc32c", FileLoadStrategy::SafeDirectDisk, false},
+        {"SafeDirectDisk checked", FileLoadStrategy::SafeDirectDisk, true},
+    }};
+
+    for (const FileBench& bench : file_benches)
+    {
+        for (bool cold : {true, false})
+        {
+            if (cold && !can_evict)
+            {
+                continue;
+            }
+            std::fprintf(stderr,
+                         "%.*s %s %llu bytes\n",
+                         static_cast<int>(bench.name.size()),
+                         bench.name.data(),
+                         cold ? "cold" : "warm",
+                         static_cast<unsigned long long>(options.max_size));
+            auto evict = [&]() -> void {
+                if (cold)
+                {
+                    dae::io::evict_file(file);
+                }
+            };
+            auto load = [&]() -> bool {
+                return bench.checked ? load_checked(file, bench.strategy, expected)
+                                     : load_then_checksum(file, bench.strategy, expected);
+            };
+            results.push_back(
+                measure(bench.name, cold ? "cold" : "warm", options.max_size, options.iterations, evict, load));
+        }
+    }
+
+    if (!options.keep)
+    {
+        std::filesystem::remove(path, error);
+    }
+
+    dae::bench::print_results(results, options.json, columns);
+    return 0;
+}
@@ -0,0 +1,253 @@
+/**
+ * @brief Benchmarks `CsvTokenizer` against splitting into lines with `split()`, splitting each line into fields with
+ * `split()` again, and trimming every field. The tokenizer is timed on the whole buffer at once, and fed in chunks as
+ * if the text were being streamed in from a file.
+ *
+ * The baseline does not understand quotes, so it is run over text without any, and the tokenizer is additionally run
+ * over text where a share of the fields are quoted, with delimiters, newlines, and escaped quotes inside them.
+ *
+ * Usage: daedalus_csv_bench [--size BYTES] [--chunk-size BYTES] [--iterations N] [--json]
+ *
+ * Results are written to stdout as CSV (or JSON with --json), one row per implementation and input. Progress is
+ * written to stderr.
+ */
+
+#include "daedalus/strings/csv.h"
+#include "daedalus/strings/utils.h"
+
+#include "bench_common.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+using dae::strings::CsvRecord;
+using dae::strings::CsvTokenizer;
+
+constexpr uint64_t FIELDS_PER_RECORD = 8;
+
+/**
+ * @brief Settings parsed from the command line.
+ */
+struct BenchOptions
+{
+    uint64_t size{static_cast<uint64_t>(256) * 1024 * 1024};
+    uint64_t chunk_size{static_cast<uint64_t>(1) * 1024 * 1024};
+    uint32_t iterations{5};
+    bool json{false};
+};
+
+/**
+ * @brief A single row of output.
+ */
+struct BenchResult
+{
+    std::string_view implementation;
+    std::string_view input;
+    uint64_t size{0};
+    uint64_t fields{0};
+    uint32_t iterations{0};
+    double min_ms{0.0};
+    double median_ms{0.0};
+    double throughput_gb_s{0.0};
+};
+
+/**
+ * @brief Generates CSV of about `size` bytes, with a mix of short words and numbers, some with padding around them.
+ *
+ * @param quoted_percent The share of fields to quote, some of which get a delimiter, a newline, or an escaped quote.
+ */
+auto generate_csv(uint64_t size, uint32_t quoted_percent, std::mt19937_64& random) -> std::string
+{
+    std::string text;
+    text.reserve(size + 256);
+    std::uniform_int_distribution<uint32_t> percent(0, 99);
+    std::uniform_int_distribution<uint32_t> length(1, 12);
+    std::uniform_int_distribution<int> character('a', 'z');
+    std::uniform_int_distribution<uint32_t> number(0, 1'000'000);
+
+    while (text.size() < size)
+    {
+        for (uint64_t field = 0; field < FIELDS_PER_RECORD; field++)
+        {
+            if (field != 0)
+            {
+                text.push_back(',');
+            }
+            if (percent(random) < 10)
+            {
+                text.push_back(' ');
+            }
+
+            if (percent(random) < quoted_percent)
+            {
+                text.push_back('"');
+                for (uint32_t i = length(random); i > 0; i--)
+                {
+                    text.push_back(static_cast<char>(character(random)));
+                }
+                const uint32_t extra = percent(random);
+                if (extra < 20)
+                    text.append(", ");
+                else if (extra < 30)
+                    text.append("\"\"");
+                else if (extra < 35)
+                    text.push_back('\n');
+                text.push_back('"');
+            }
+            else if (field % 2 == 0)
+            {
+                text.append(std::to_string(number(random)));
+            }
+            else
+            {
+                for (uint32_t i = length(random); i > 0; i--)
+                {
+                    text.push_back(static_cast<char>(character(random)));
+                }
+            }
+        }
+        text.push_back('\n');
+    }
+    return text;
+}
+
+/**
+ * @brief The approach the tokenizer replaces: split into lines, split each line into fields, and trim each field.
+ */
+auto tokenize_baseline(const std::string& text) -> uint64_t
+{
+    uint64_t fields = 0;
+    for (std::string_view line : dae::strings::split(text.data(), text.size(), '\n'))
+    {
+        for (std::string_view field : dae::strings::split(line.data(), line.size(), ','))
+        {
+            static_cast<void>(dae::strings::trim(field));
+            fields++;
+        }
+    }
+    return fields;
+}
+
+/**
+ * @brief Reads every record the tokenizer has ready.
+ *
+ * @return The number of fields read.
+ */
+auto drain(CsvTokenizer& tokenizer) -> uint64_t
+{
+    uint64_t fields = 0;
+    for (std::optional<CsvRecord> record = tokenizer.next(); record; record = tokenizer.next())
+    {
+        fields += record->size();
+    }
+    return fields;
+}
+
+auto tokenize_whole(const std::string& text) -> uint64_t
+{
+    CsvTokenizer tokenizer({.trim_fields = true});
+    tokenizer.feed(text);
+    tokenizer.finish();
+    return drain(tokenizer);
+}
+
+auto tokenize_chunked(const std::string& text, uint64_t chunk_size) -> uint64_t
+{
+    CsvTokenizer tokenizer({.trim_fields = true});
+    uint64_t fields = 0;
+    for (uint64_t offset = 0; offset < text.size(); offset += chunk_size)
+    {
+        tokenizer.feed(std::string_view(text).substr(offset, chunk_size));
+        fields += drain(tokenizer);
+    }
+    tokenizer.finish();
+    return fields + drain(tokenizer);
+}
+
+/**
+ * @brief Times a function over a number of iterations.
+ *
+ * @param run Returns the number of fields found.
+ */
+template <typename Run>
+auto measure(std::string_view implementation, std::string_view input, uint64_t size, uint32_t iterations, Run&& run)
+    -> BenchResult
+{
+    BenchResult result{
+        .implementation = implementation,
+        .input = input,
+        .size = size,
+        .iterations = iterations,
+    };
+
+    const dae::bench::Timings timings =
+        dae::bench::time_iterations(iterations, [&]() -> void { result.fields = run(); });
+    result.min_ms = timings.min_us / 1'000.0;
+    result.median_ms = timings.median_us / 1'000.0;
+    result.throughput_gb_s = dae::bench::gb_per_second(size, timings.median_us);
+    return result;
+}
+
+auto columns(const BenchResult& r) -> std::vector<dae::bench::Column>
+{
+    return {
+        {"implementation", r.implementation},
+        {"input", r.input},
+        {"size_bytes", r.size},
+        {"fields", r.fields},
+        {"iterations", r.iterations},
+        {"min_ms", r.min_ms},
+        {"median_ms", r.median_ms},
+        {"throughput_gb_s", r.throughput_gb_s},
+    };
+}
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    BenchOptions options;
+    const bool parsed = dae::bench::Options("daedalus_csv_bench")
+                            .number("--size", "BYTES", options.size)
+                            .number("--chunk-size", "BYTES", options.chunk_size)
+                            .number("--iterations", "N", options.iterations)
+                            .flag("--json", options.json)
+                            .parse(argc, argv);
+    if (!parsed)
+    {
+        return 1;
+    }
+
+    std::mt19937_64 random(0xDAEDA105);
+    std::vector<BenchResult> results;
+
+    std::fprintf(stderr, "unquoted\n");
+    const std::string plain = generate_csv(options.size, 0, random);
+    results.push_back(measure("split+trim", "unquoted", plain.size(), options.iterations, [&]() -> uint64_t {
+        return tokenize_baseline(plain);
+    }));
+    results.push_back(measure("tokenizer", "unquoted", plain.size(), options.iterations, [&]() -> uint64_t {
+        return tokenize_whole(plain);
+    }));
+    results.push_back(measure("tokenizer chunked", "unquoted", plain.size(), options.iterations, [&]() -> uint64_t {
+        return tokenize_chunked(plain, options.chunk_size);
+    }));
+
+    std::fprintf(stderr, "quoted\n");
+    const std::string quoted = generate_csv(options.size, 25, random);
+    results.push_back(measure("tokenizer", "25% quoted", quoted.size(), options.iterations, [&]() -> uint64_t {
+        return tokenize_whole(quoted);
+    }));
+    results.push_back(measure("tokenizer chunked", "25% quoted", quoted.size(), options.iterations, [&]() -> uint64_t {
+        return tokenize_chunked(quoted, options.chunk_size);
+    }));
+
+    dae::bench::print_results(results, options.json, columns);
+    return 0;
+}
@@ -0,0 +1,333 @@
+/**
+ * @brief Benchmarks every FileLoadStrategy, sync and async, against files with a cold and a warm filesystem cache.
+ *
+ * Usage: daedalus_io_bench [--dir DIR] [--max-size BYTES] [--files N] [--iterations N] [--json] [--keep]
+ *
+ * Results are written to stdout as CSV (or JSON with --json), one row per strategy, mode, cache state, and file size.
+ * Progress is written to stderr.
+ */
+
+#include "daedalus/io/cache.h"
+#include "daedalus/io/file.h"
+
+#include "bench_common.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+using dae::io::File;
+using dae::io::FileLoadStrategy;
+
+constexpr double BYTES_PER_MIB = 1024.0 * 1024.0;
+constexpr uint64_t PAGE_SIZE = 4096;
+
+/**
+ * @brief Settings parsed from the command line.
+ */
+struct BenchOptions
+{
+    std::filesystem::path directory{std::filesystem::temp_directory_path() / "daedalus_io_bench"};
+    uint64_t max_size{static_cast<uint64_t>(64) * 1024 * 1024};
+    uint32_t files{4};
+    uint32_t iterations{5};
+    bool json{false};
+    bool keep{false};
+};
+
+/**
+ * @brief A single row of output.
+ */
+struct BenchResult
+{
+    std::string_view strategy;
+    std::string_view mode;
+    std::string_view cache;
+    uint64_t size{0};
+    uint32_t files{0};
+    uint32_t iterations{0};
+    uint32_t failures{0};
+    double min_us{0.0};
+    double median_us{0.0};
+    double mean_us{0.0};
+    double max_us{0.0};
+    double throughput_mib_s{0.0};
+};
+
+/**
+ * @brief A load strategy to benchmark, including load_file_parallel which has no FileLoadStrategy of its own.
+ */
+struct BenchStrategy
+{
+    std::string_view name;
+    FileLoadStrategy strategy;
+    bool parallel{false};
+};
+
+/**
+ * @brief Writes a file of random bytes and flushes it, so that it can be evicted from the cache afterwards.
+ */
+auto generate_file(const std::filesystem::path& path, uint64_t size, std::mt19937_64& random) -> bool
+{
+    std::vector<std::byte> data(size);
+    for (std::byte& byte : data)
+    {
+        byte = static_cast<std::byte>(random());
+    }
+
+    return dae::io::save_file(path.string(),
+                              data,
+                              dae::io::FileSaveOptions{
+                                  .save_strategy = FileLoadStrategy::AllowCached,
+                                  .atomic_replace = false,
+                                  .sync_mode = dae::io::FileSyncMode::Data,
+                              });
+}
+
+/**
+ * @brief Reads one byte from every page of a loaded file, so a mapped file is actually faulted in and the compiler
+ * cannot skip the load.
+ */
+auto touch(const File& file) -> uint64_t
+{
+    const auto* bytes = static_cast<const unsigned char*>(file.buffer);
+    uint64_t sum = 0;
+    for (uint64_t offset = 0; offset < file.bytes_read; offset += PAGE_SIZE)
+    {
+        sum += bytes[offset]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    return sum;
+}
+
+/**
+ * @brief Loads every file one after the other.
+ *
+ * @return The number of files that failed to load.
+ */
+auto load_sync(const std::vector<std::string>& paths, const BenchStrategy& strategy, uint64_t& checksum) -> uint32_t
+{
+    uint32_t failures = 0;
+    for (const std::string& path : paths)
+    {
+        std::optional<File> file = strategy.parallel
+                                       ? dae::io::load_file_parallel(path)
+                                       : dae::io::load_file(path, strategy.strategy);
+        if (!file)
+        {
+            failures++;
+            continue;
+        }
+        checksum += touch(file.value());
+        dae::io::free_file(file.value());
+    }
+    return failures;
+}
+
+/**
+ * @brief Starts loading every file at once, then collects them in order.
+ *
+ * @return The number of files that failed to load.
+ */
+auto load_async(const std::vector<std::string>& paths, const BenchStrategy& strategy, uint64_t& checksum) -> uint32_t
+{
+    uint32_t failures = 0;
+    std::vector<dae::io::FileFuture> futures;
+    futures.reserve(paths.size());
+    for (const std::string& path : paths)
+    {
+        std::optional<dae::io::FileFuture> future = dae::io::load_file_async(path, strategy.strategy);
+        if (!future)
+        {
+            failures++;
+            continue;
+        }
+        futures.push_back(std::move(future.value()));
+    }
+
+    for (dae::io::FileFuture& future : futures)
+    {
+        std::optional<File> file = future.get();
+        if (!file)
+        {
+            failures++;
+            continue;
+        }
+        checksum += touch(file.value());
+        dae::io::free_file(file.value());
+    }
+    return failures;
+}
+
+auto run(const std::vector<std::string>& paths,
+         uint64_t size,
+         const BenchStrategy& strategy,
+         bool async,
+         bool cold,
+         uint32_t iterations,
+         uint64_t& checksum) -> BenchResult
+{
+    BenchResult result{
+        .strategy = strategy.name,
+        .mode = async ? "async" : "sync",
+        .cache = cold ? "cold" : "warm",
+        .size = size,
+        .files = static_cast<uint32_t>(paths.size()),
+        .iterations = iterations,
+    };
+
+    // A warm run needs the files in the cache to begin with
+    if (!cold)
+    {
+        result.failures += load_sync(paths, BenchStrategy{"", FileLoadStrategy::AllowCached}, checksum);
+    }
+
+    auto evict = [&]() -> void {
+        if (cold)
+        {
+            for (const std::string& path : paths)
+            {
+                dae::io::evict_file(path);
+            }
+        }
+    };
+    const dae::bench::Timings timings = dae::bench::time_iterations(iterations, evict, [&]() -> void {
+        result.failures += async ? load_async(paths, strategy, checksum) : load_sync(paths, strategy, checksum);
+    });
+
+    // Latency is per file, as the time for a whole batch divided by the number of files in it
+    const auto files = static_cast<double>(paths.size());
+    result.min_us = timings.min_us / files;
+    result.median_us = timings.median_us / files;
+    result.mean_us = timings.mean_us / files;
+    result.max_us = timings.max_us / files;
+    result.throughput_mib_s =
+        result.mean_us > 0.0 ? (static_cast<double>(size) / BYTES_PER_MIB) / (result.mean_us / 1'000'000.0) : 0.0;
+    return result;
+}
+
+auto columns(const BenchResult& r) -> std::vector<dae::bench::Column>
+{
+    return {
+        {"strategy", r.strategy},
+        {"mode", r.mode},
+        {"cache", r.cache},
+        {"size_bytes", r.size},
+        {"files", r.files},
+        {"iterations", r.iterations},
+        {"failures", r.failures},
+        {"min_us", r.min_us},
+        {"median_us", r.median_us},
+        {"mean_us", r.mean_us},
+        {"max_us", r.max_us},
+        {"throughput_mib_s", r.throughput_mib_s},
+    };
+}
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    BenchOptions options;
+    const bool parsed = dae::bench::Options("daedalus_io_bench")
+                            .path("--dir", "DIR", options.directory)
+                            .number("--max-size", "BYTES", options.max_size)
+                            .number("--files", "N", options.files)
+                            .number("--iterations", "N", options.iterations)
+                            .flag("--json", options.json)
+                            .flag("--keep", options.keep)
+                            .parse(argc, argv);
+    if (!parsed)
+    {
+        return 1;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(options.directory, error);
+    if (error)
+    {
+        std::fprintf(stderr, "could not create %s\n", options.directory.string().c_str());
+        return 1;
+    }
+
+    const BenchStrategy strategies[] = { // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        {"StdLibrary", FileLoadStrategy::StdLibrary},
+        {"AllowCached", FileLoadStrategy::AllowCached},
+        {"SafeDirectDisk", FileLoadStrategy::SafeDirectDisk},
+        {"Mapped", FileLoadStrategy::Mapped},
+        {"Parallel", FileLoadStrategy::SafeDirectDisk, true},
+    };
+
+    std::mt19937_64 random(0xDAEDA105);
+    std::vector<BenchResult> results;
+    uint64_t checksum = 0;
+
+    // Sizes sweep up by 16x from one page
+    for (uint64_t size = PAGE_SIZE; size <= options.max_size; size *= 16)
+    {
+        std::vector<std::string> paths;
+        for (uint32_t i = 0; i < options.files; i++)
+        {
+            std::filesystem::path path =
+                options.directory / ("bench_" + std::to_string(size) + "_" + std::to_string(i));
+            if (!generate_file(path, size, random))
+            {
+                std::fprintf(stderr, "could not write %s\n", path.string().c_str());
+                return 1;
+            }
+            paths.push_back(path.string());
+        }
+
+        const bool can_evict = dae::io::evict_file(paths.front());
+        if (!can_evict)
+        {
+            std::fprintf(stderr, "evicting files from the cache is not supported here, skipping cold runs\n");
+        }
+
+        for (const BenchStrategy& strategy : strategies)
+        {
+            for (bool async : {false, true})
+            {
+                // load_file_parallel has no async form
+                if (async && strategy.parallel)
+                {
+                    continue;
+                }
+                for (bool cold : {true, false})
+                {
+                    if (cold && !can_evict)
+                    {
+                        continue;
+                    }
+                    std::fprintf(stderr,
+                                 "%.*s %s %s %llu bytes\n",
+                                 static_cast<int>(strategy.name.size()),
+                                 strategy.name.data(),
+                                 async ? "async" : "sync",
+                                 cold ? "cold" : "warm",
+                                 static_cast<unsigned long long>(size));
+                    results.push_back(run(paths, size, strategy, async, cold, options.iterations, checksum));
+                }
+            }
+        }
+
+        if (!options.keep)
+        {
+            for (const std::string& path : paths)
+            {
+                std::filesystem::remove(path, error);
+            }
+        }
+    }
+
+    dae::bench::print_results(results, options.json, columns);
+
+    // Printing the checksum keeps every load observable
+    std::fprintf(stderr, "checksum %llu\n", static_cast<unsigned long long>(checksum));
+    return 0;
+}
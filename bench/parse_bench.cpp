@@ -0,0 +1,213 @@
+/**
+ * @brief Benchmarks `parse_column()` against the `std::stoi()`/`std::stod()` path it replaces, where every field is
+ * copied into a temporary `std::string` first, and against calling `std::from_chars()` directly.
+ *
+ * Usage: daedalus_parse_bench [--count N] [--iterations N] [--json]
+ *
+ * Results are written to stdout as CSV (or JSON with --json), one row per implementation and column. Progress is
+ * written to stderr.
+ */
+
+#include "daedalus/strings/parse.h"
+
+#include "bench_common.h"
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief Settings parsed from the command line.
+ */
+struct BenchOptions
+{
+    uint64_t count{static_cast<uint64_t>(10'000'000)};
+    uint32_t iterations{5};
+    bool json{false};
+};
+
+/**
+ * @brief A single row of output.
+ */
+struct BenchResult
+{
+    std::string_view implementation;
+    std::string_view column;
+    uint64_t count{0};
+    uint64_t checksum{0};
+    uint32_t iterations{0};
+    double min_ms{0.0};
+    double median_ms{0.0};
+    double ns_per_field{0.0};
+};
+
+/**
+ * @brief A column of fields, stored back to back in one string like they would be in a loaded file.
+ */
+struct Column
+{
+    std::string_view name;
+    std::string text;
+    std::vector<std::string_view> fields;
+};
+
+/**
+ * @brief Builds a column from `count` calls to `generate`, which returns the text of one field.
+ */
+template <typename Generate>
+auto make_column(std::string_view name, uint64_t count, Generate&& generate) -> Column
+{
+    Column column{.name = name, .text = {}, .fields = {}};
+    std::vector<size_t> ends;
+    ends.reserve(count);
+    for (uint64_t i = 0; i < count; i++)
+    {
+        column.text.append(generate());
+        ends.push_back(column.text.size());
+    }
+    column.fields.reserve(count);
+    size_t start = 0;
+    for (size_t end : ends)
+    {
+        column.fields.emplace_back(column.text.data() + start, end - start);
+        start = end;
+    }
+    return column;
+}
+
+/**
+ * @brief Times a function over a number of iterations.
+ *
+ * @param run Returns a checksum of the parsed values, which every implementation should agree on.
+ */
+template <typename Run>
+auto measure(std::string_view implementation, const Column& column, uint32_t iterations, Run&& run) -> BenchResult
+{
+    BenchResult result{
+        .implementation = implementation,
+        .column = column.name,
+        .count = column.fields.size(),
+        .iterations = iterations,
+    };
+
+    const dae::bench::Timings timings =
+        dae::bench::time_iterations(iterations, [&]() -> void { result.checksum = run(); });
+    result.min_ms = timings.min_us / 1'000.0;
+    result.median_ms = timings.median_us / 1'000.0;
+    result.ns_per_field = (timings.median_us * 1'000.0) / static_cast<double>(column.fields.size());
+    return result;
+}
+
+template <typename T>
+auto sum(std::span<const T> values) -> uint64_t
+{
+    uint64_t total = 0;
+    for (T value : values)
+    {
+        total += static_cast<uint64_t>(value);
+    }
+    return total;
+}
+
+/**
+ * @brief Times every implementation over one column.
+ *
+ * @param stl The standard library function that parses a `std::string`, such as `std::stoll()`.
+ */
+template <typename T, typename Stl>
+auto bench_column(const Column& column, uint32_t iterations, Stl&& stl, std::vector<BenchResult>& results) -> void
+{
+    std::fprintf(stderr, "%.*s\n", static_cast<int>(column.name.size()), column.name.data());
+    std::vector<T> values(column.fields.size());
+
+    results.push_back(measure("std::string+stl", column, iterations, [&]() -> uint64_t {
+        for (size_t i = 0; i < column.fields.size(); i++)
+        {
+            values[i] = static_cast<T>(stl(std::string(column.fields[i])));
+        }
+        return sum<T>(values);
+    }));
+    results.push_back(measure("std::from_chars", column, iterations, [&]() -> uint64_t {
+        for (size_t i = 0; i < column.fields.size(); i++)
+        {
+            const std::string_view field = column.fields[i];
+            std::from_chars(field.data(), field.data() + field.size(), values[i]);
+        }
+        return sum<T>(values);
+    }));
+    results.push_back(measure("parse_column", column, iterations, [&]() -> uint64_t {
+        dae::strings::parse_column<T>(column.fields, values);
+        return sum<T>(values);
+    }));
+}
+
+auto columns(const BenchResult& r) -> std::vector<dae::bench::Column>
+{
+    return {
+        {"implementation", r.implementation},
+        {"column", r.column},
+        {"count", r.count},
+        {"checksum", r.checksum},
+        {"iterations", r.iterations},
+        {"min_ms", r.min_ms},
+        {"median_ms", r.median_ms},
+        {"ns_per_field", r.ns_per_field},
+    };
+}
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    BenchOptions options;
+    const bool parsed = dae::bench::Options("daedalus_parse_bench")
+                            .number("--count", "N", options.count)
+                            .number("--iterations", "N", options.iterations)
+                            .flag("--json", options.json)
+                            .parse(argc, argv);
+    if (!parsed)
+    {
+        return 1;
+    }
+
+    std::mt19937_64 random(0xDAEDA105);
+    std::vector<BenchResult> results;
+    auto stoll = [](const std::string& s) -> long long { return std::stoll(s); };
+    auto stod = [](const std::string& s) -> double { return std::stod(s); };
+
+    // Fixed width, like dates written as YYYYMMDD
+    std::uniform_int_distribution<int32_t> date(19'000'101, 20'991'231);
+    const Column dates = make_column("int32 8 digits", options.count, [&]() -> std::string {
+        return std::to_string(date(random));
+    });
+    bench_column<int32_t>(dates, options.iterations, stoll, results);
+
+    // Varying width, with negatives
+    std::uniform_int_distribution<int32_t> small(-100'000, 100'000);
+    const Column smalls = make_column("int32 varying", options.count, [&]() -> std::string {
+        return std::to_string(small(random));
+    });
+    bench_column<int32_t>(smalls, options.iterations, stoll, results);
+
+    // Fixed width, like nanosecond timestamps
+    std::uniform_int_distribution<int64_t> timestamp(1'000'000'000'000'000, 1'999'999'999'999'999);
+    const Column timestamps = make_column("int64 16 digits", options.count, [&]() -> std::string {
+        return std::to_string(timestamp(random));
+    });
+    bench_column<int64_t>(timestamps, options.iterations, stoll, results);
+
+    std::uniform_real_distribution<double> real(-1'000.0, 1'000.0);
+    const Column reals = make_column("double", options.count, [&]() -> std::string {
+        return std::to_string(real(random));
+    });
+    bench_column<double>(reals, options.iterations, stod, results);
+
+    dae::bench::print_results(results, options.json, columns);
+    return 0;
+}
@@ -0,0 +1,332 @@
+/**
+ * @brief Benchmarks `split()` and `get_line()` with every string kernel the CPU supports, against the original
+ * `memchr` per line implementation. Each kernel's split counts the pieces first and sizes a vector for them, as
+ * `split()` does. Also benchmarks the allocation free alternatives: iterating a `split_view`, and `split_into()` a
+ * fixed size buffer that is reused until the whole buffer has been split. Building a `LineIndex` is timed on one
+ * thread and on every hardware thread.
+ *
+ * Text with "\r\n" line endings is split on the two byte delimiter with each kernel set's `split_substring`, against
+ * `std::string_view::find()`, and on either byte with `split_any`, against `std::string_view::find_first_of()`.
+ *
+ * Usage: daedalus_strings_bench [--size BYTES] [--iterations N] [--json]
+ *
+ * Results are written to stdout as CSV (or JSON with --json), one row per function, implementation, and line length.
+ * Progress is written to stderr.
+ */
+
+#include "daedalus/strings/kernels.h"
+#include "daedalus/strings/line_index.h"
+#include "daedalus/strings/split_view.h"
+#include "daedalus/strings/utils.h"
+
+#include "bench_common.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+namespace kernels = dae::strings::kernels;
+
+constexpr size_t SPLIT_INTO_BATCH = 256;
+
+/**
+ * @brief Settings parsed from the command line.
+ */
+struct BenchOptions
+{
+    uint64_t size{static_cast<uint64_t>(256) * 1024 * 1024};
+    uint32_t iterations{5};
+    bool json{false};
+};
+
+/**
+ * @brief A single row of output.
+ */
+struct BenchResult
+{
+    std::string_view function;
+    std::string_view implementation;
+    uint64_t mean_line_length{0};
+    uint64_t size{0};
+    uint64_t pieces{0};
+    uint32_t iterations{0};
+    double min_ms{0.0};
+    double median_ms{0.0};
+    double throughput_gb_s{0.0};
+};
+
+/**
+ * @brief Generates printable text with lines whose lengths average `mean_line_length`.
+ *
+ * @param newline What to end each line with.
+ */
+auto generate_text(uint64_t size, uint64_t mean_line_length, std::mt19937_64& random, std::string_view newline = "\n")
+    -> std::string
+{
+    std::string text;
+    text.reserve(size + newline.size());
+    std::uniform_int_distribution<uint64_t> line_length(0, (2 * mean_line_length) - 1);
+    std::uniform_int_distribution<int> character('a', 'z');
+    uint64_t until_newline = line_length(random);
+    while (text.size() < size)
+    {
+        if (until_newline == 0)
+        {
+            text.append(newline);
+            until_newline = line_length(random);
+            continue;
+        }
+        text.push_back(static_cast<char>(character(random)));
+        until_newline--;
+    }
+    return text;
+}
+
+/**
+ * @brief The original implementation of `get_line()`, with one `memchr` per line.
+ */
+auto get_line_baseline(const char* str, size_t max_search_size, char delim) -> std::string_view
+{
+    const char* endl = static_cast<const char*>(std::memchr(str, delim, max_search_size));
+    const size_t len = endl != nullptr ? static_cast<size_t>(endl - str) : max_search_size;
+    return {str, len};
+}
+
+/**
+ * @brief The original implementation of `split()`, calling `get_line()` once per piece.
+ */
+auto split_baseline(const char* buf, size_t size, char delim) -> std::vector<std::string_view>
+{
+    const char* front = buf;
+    const char* back = buf + size; // NOLINT
+    std::vector<std::string_view> svs;
+    while (front < back)
+    {
+        std::string_view s = get_line_baseline(front, back - front, delim);
+        front += s.size() + 1; // NOLINT
+        svs.push_back(s);
+    }
+    return svs;
+}
+
+/**
+ * @brief Splits on a multi-byte delimiter by searching for it with `std::string_view::find()`, which looks for its
+ * first byte with `memchr` and compares the rest at every occurrence.
+ *
+ * @return The number of pieces.
+ */
+auto split_substring_baseline(std::string_view text, std::string_view delim) -> uint64_t
+{
+    uint64_t pieces = 0;
+    size_t start = 0;
+    for (size_t pos = text.find(delim); pos != std::string_view::npos; pos = text.find(delim, start))
+    {
+        pieces++;
+        start = pos + delim.size();
+    }
+    return pieces + (start < text.size() ? 1 : 0);
+}
+
+/**
+ * @brief Splits on any of a set of characters with `std::string_view::find_first_of()`.
+ *
+ * @return The number of pieces.
+ */
+auto split_any_baseline(std::string_view text, std::string_view delims) -> uint64_t
+{
+    uint64_t pieces = 0;
+    size_t start = 0;
+    for (size_t pos = text.find_first_of(delims); pos != std::string_view::npos;
+         pos = text.find_first_of(delims, start))
+    {
+        pieces++;
+        start = pos + 1;
+    }
+    return pieces + (start < text.size() ? 1 : 0);
+}
+
+/**
+ * @brief Splits a whole buffer with a `split_into()` style function into a small reused batch.
+ *
+ * @return The number of pieces.
+ */
+template <typename SplitInto>
+auto split_batched(const std::string& text, SplitInto&& split_into) -> uint64_t
+{
+    std::array<std::string_view, SPLIT_INTO_BATCH> batch;
+    uint64_t pieces = 0;
+    for (size_t offset = 0; offset < text.size();)
+    {
+        const dae::strings::SplitResult result = split_into(text.data() + offset, text.size() - offset, batch);
+        pieces += result.count;
+        offset += result.consumed;
+    }
+    return pieces;
+}
+
+/**
+ * @brief Walks a whole buffer line by line with a get_line function.
+ *
+ * @return The number of lines.
+ */
+template <typename GetLine>
+auto count_lines(const std::string& text, GetLine&& get_line) -> uint64_t
+{
+    uint64_t lines = 0;
+    for (size_t front = 0; front < text.size(); lines++)
+    {
+        front += get_line(text.data() + front, text.size() - front, '\n').size() + 1; // NOLINT
+    }
+    return lines;
+}
+
+/**
+ * @brief Times a function over a number of iterations.
+ *
+ * @param run Returns the number of pieces found, which every implementation should agree on.
+ */
+template <typename Run>
+auto measure(std::string_view function,
+             std::string_view implementation,
+             uint64_t mean_line_length,
+             uint64_t size,
+             uint32_t iterations,
+             Run&& run) -> BenchResult
+{
+    BenchResult result{
+        .function = function,
+        .implementation = implementation,
+        .mean_line_length = mean_line_length,
+        .size = size,
+        .iterations = iterations,
+    };
+
+    const dae::bench::Timings timings =
+        dae::bench::time_iterations(iterations, [&]() -> void { result.pieces = run(); });
+    result.min_ms = timings.min_us / 1'000.0;
+    result.median_ms = timings.median_us / 1'000.0;
+    result.throughput_gb_s = dae::bench::gb_per_second(size, timings.median_us);
+    return result;
+}
+
+auto columns(const BenchResult& r) -> std::vector<dae::bench::Column>
+{
+    return {
+        {"function", r.function},
+        {"implementation", r.implementation},
+        {"mean_line_length", r.mean_line_length},
+        {"size_bytes", r.size},
+        {"pieces", r.pieces},
+        {"iterations", r.iterations},
+        {"min_ms", r.min_ms},
+        {"median_ms", r.median_ms},
+        {"throughput_gb_s", r.throughput_gb_s},
+    };
+}
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    BenchOptions options;
+    const bool parsed = dae::bench::Options("daedalus_strings_bench")
+                            .number("--size", "BYTES", options.size)
+                            .number("--iterations", "N", options.iterations)
+                            .flag("--json", options.json)
+                            .parse(argc, argv);
+    if (!parsed)
+    {
+        return 1;
+    }
+
+    std::mt19937_64 random(0xDAEDA105);
+    std::vector<BenchResult> results;
+    const std::vector<kernels::KernelSet> kernel_sets = kernels::get_supported_kernels();
+    std::fprintf(stderr, "dispatching to %s\n", kernels::get_kernels().name);
+
+    for (uint64_t mean_line_length : {8, 32, 128})
+    {
+        std::fprintf(stderr, "lines of %llu bytes\n", static_cast<unsigned long long>(mean_line_length));
+        const std::string text = generate_text(options.size, mean_line_length, random);
+        auto bench = [&](std::string_view function, std::string_view implementation, auto&& run) -> void {
+            results.push_back(
+                measure(function, implementation, mean_line_length, text.size(), options.iterations, run));
+        };
+
+        bench("split", "baseline", [&]() -> uint64_t { return split_baseline(text.data(), text.size(), '\n').size(); });
+        for (const kernels::KernelSet& kernel_set : kernel_sets)
+        {
+            bench("split", kernel_set.name, [&]() -> uint64_t {
+                std::vector<std::string_view> pieces(kernel_set.count(text.data(), text.size(), '\n') + 1);
+                pieces.resize(kernel_set.split(text.data(), text.size(), '\n', pieces).count);
+                return pieces.size();
+            });
+        }
+
+        bench("split_view", "dispatch", [&]() -> uint64_t {
+            uint64_t pieces = 0;
+            for ([[maybe_unused]] std::string_view piece : dae::strings::split_view(text, '\n'))
+            {
+                pieces++;
+            }
+            return pieces;
+        });
+        bench("split_into", "dispatch", [&]() -> uint64_t {
+            return split_batched(text, [](const char* buf, size_t size, std::span<std::string_view> out) {
+                return dae::strings::split_into(buf, size, '\n', out);
+            });
+        });
+
+        bench("line_index", "1 thread", [&]() -> uint64_t {
+            return dae::strings::LineIndex(text, {.thread_count = 1}).size();
+        });
+        bench("line_index", "all threads", [&]() -> uint64_t { return dae::strings::LineIndex(text).size(); });
+
+        bench("get_line", "baseline", [&]() -> uint64_t { return count_lines(text, get_line_baseline); });
+        bench("get_line", "dispatch", [&]() -> uint64_t {
+            return count_lines(text, [](const char* str, size_t size, char delim) -> std::string_view {
+                return dae::strings::get_line(str, size, delim);
+            });
+        });
+    }
+
+    for (uint64_t mean_line_length : {8, 32, 128})
+    {
+        std::fprintf(stderr, "crlf lines of %llu bytes\n", static_cast<unsigned long long>(mean_line_length));
+        const std::string text = generate_text(options.size, mean_line_length, random, "\r\n");
+        auto bench = [&](std::string_view function, std::string_view implementation, auto&& run) -> void {
+            results.push_back(
+                measure(function, implementation, mean_line_length, text.size(), options.iterations, run));
+        };
+
+        bench("split crlf", "baseline", [&]() -> uint64_t { return split_substring_baseline(text, "\r\n"); });
+        for (const kernels::KernelSet& kernel_set : kernel_sets)
+        {
+            bench("split crlf", kernel_set.name, [&]() -> uint64_t {
+                return split_batched(text, [&](const char* buf, size_t size, std::span<std::string_view> out) {
+                    return kernel_set.split_substring(buf, size, "\r\n", out);
+                });
+            });
+        }
+
+        bench("split_any crlf", "baseline", [&]() -> uint64_t { return split_any_baseline(text, "\r\n"); });
+        for (const kernels::KernelSet& kernel_set : kernel_sets)
+        {
+            bench("split_any crlf", kernel_set.name, [&]() -> uint64_t {
+                return split_batched(text, [&](const char* buf, size_t size, std::span<std::string_view> out) {
+                    return kernel_set.split_any(buf, size, "\r\n", out);
+                });
+            });
+        }
+    }
+
+    dae::bench::print_results(results, options.json, columns);
+    return 0;
+}
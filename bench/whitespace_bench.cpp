@@ -0,0 +1,304 @@
+/**
+ * @brief Benchmarks `trim()`, `trim_all()`, and `is_all_whitespace()` with every string kernel the CPU supports,
+ * against the original implementations: `find_first_not_of()`/`find_last_not_of()` with a set of six characters for
+ * trimming, and `std::isspace()` on every byte for `is_all_whitespace()`.
+ *
+ * Fields are generated with a varying amount of whitespace around a word, from a few bytes like padded CSV, up to long
+ * runs like indented text. `is_all_whitespace()` is run over fields that are entirely whitespace, which is its worst
+ * case as every byte has to be checked.
+ *
+ * Usage: daedalus_whitespace_bench [--size BYTES] [--iterations N] [--json]
+ *
+ * Results are written to stdout as CSV (or JSON with --json), one row per function, implementation, and input.
+ * Progress is written to stderr.
+ */
+
+#include "daedalus/strings/kernels.h"
+#include "daedalus/strings/utils.h"
+
+#include "bench_common.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+namespace kernels = dae::strings::kernels;
+
+/**
+ * @brief Settings parsed from the command line.
+ */
+struct BenchOptions
+{
+    uint64_t size{static_cast<uint64_t>(64) * 1024 * 1024};
+    uint32_t iterations{5};
+    bool json{false};
+};
+
+/**
+ * @brief A single row of output.
+ */
+struct BenchResult
+{
+    std::string_view function;
+    std::string_view implementation;
+    std::string_view input;
+    uint64_t size{0};
+    uint64_t checksum{0};
+    uint32_t iterations{0};
+    double min_ms{0.0};
+    double median_ms{0.0};
+    double throughput_gb_s{0.0};
+};
+
+/**
+ * @brief Fields stored back to back in one string.
+ */
+struct Fields
+{
+    std::string_view name;
+    std::string text;
+    std::vector<std::string_view> views;
+};
+
+/**
+ * @brief Generates about `size` bytes of fields, each a word of 1 to 16 letters with whitespace on either side.
+ *
+ * @param mean_padding The average amount of whitespace on each side of a word.
+ * @param with_word False to make every field entirely whitespace.
+ */
+auto generate_fields(std::string_view name,
+                     uint64_t size,
+                     uint64_t mean_padding,
+                     bool with_word,
+                     std::mt19937_64& random) -> Fields
+{
+    static constexpr std::string_view WHITESPACE = " \t\n\v\f\r";
+    std::uniform_int_distribution<uint64_t> padding(0, 2 * mean_padding);
+    std::uniform_int_distribution<size_t> whitespace(0, WHITESPACE.size() - 1);
+    std::uniform_int_distribution<uint32_t> length(1, 16);
+    std::uniform_int_distribution<int> character('a', 'z');
+
+    Fields fields{.name = name, .text = {}, .views = {}};
+    fields.text.reserve(size + 256);
+    std::vector<size_t> ends;
+    while (fields.text.size() < size)
+    {
+        for (uint64_t i = padding(random); i > 0; i--)
+        {
+            // Mostly spaces, like real padding, with the occasional other character
+            fields.text.push_back(whitespace(random) < 3 ? ' ' : WHITESPACE[whitespace(random)]);
+        }
+        for (uint32_t i = with_word ? length(random) : 0; i > 0; i--)
+        {
+            fields.text.push_back(static_cast<char>(character(random)));
+        }
+        for (uint64_t i = padding(random); i > 0; i--)
+        {
+            fields.text.push_back(' ');
+        }
+        ends.push_back(fields.text.size());
+    }
+
+    fields.views.reserve(ends.size());
+    size_t start = 0;
+    for (size_t end : ends)
+    {
+        fields.views.emplace_back(fields.text.data() + start, end - start);
+        start = end;
+    }
+    return fields;
+}
+
+/**
+ * @brief The original implementation of `trim()`.
+ */
+auto trim_baseline(std::string_view sv) -> std::string_view
+{
+    static const char* space_characters = " \t\n\v\f\r";
+    size_t front = sv.find_first_not_of(space_characters);
+    if (front == std::string_view::npos)
+        return {};
+    size_t back = sv.find_last_not_of(space_characters);
+    return sv.substr(front, back - front + 1);
+}
+
+/**
+ * @brief The original implementation of `is_all_whitespace()`.
+ */
+auto is_all_whitespace_baseline(std::string_view sv) -> bool
+{
+    return std::ranges::all_of(sv, [](unsigned char c) -> int { return std::isspace(c); });
+}
+
+/**
+ * @brief Trims every field with a trim function.
+ *
+ * @return The total size of the trimmed fields, which every implementation should agree on.
+ */
+template <typename Trim>
+auto trim_fields(const Fields& fields, Trim&& trim) -> uint64_t
+{
+    uint64_t size = 0;
+    for (std::string_view field : fields.views)
+    {
+        size += trim(field).size();
+    }
+    return size;
+}
+
+/**
+ * @brief Checks every field with an is_all_whitespace function.
+ *
+ * @return The number of fields that are entirely whitespace.
+ */
+template <typename IsAllWhitespace>
+auto count_whitespace_fields(const Fields& fields, IsAllWhitespace&& is_all_whitespace) -> uint64_t
+{
+    uint64_t count = 0;
+    for (std::string_view field : fields.views)
+    {
+        count += is_all_whitespace(field) ? 1 : 0;
+    }
+    return count;
+}
+
+/**
+ * @brief Times a function over a number of iterations.
+ *
+ * @param run Returns a checksum, which every implementation should agree on.
+ */
+template <typename Run>
+auto measure(std::string_view function,
+             std::string_view implementation,
+             const Fields& fields,
+             uint32_t iterations,
+             Run&& run) -> BenchResult
+{
+    BenchResult result{
+        .function = function,
+        .implementation = implementation,
+        .input = fields.name,
+        .size = fields.text.size(),
+        .iterations = iterations,
+    };
+
+    const dae::bench::Timings timings =
+        dae::bench::time_iterations(iterations, [&]() -> void { result.checksum = run(); });
+    result.min_ms = timings.min_us / 1'000.0;
+    result.median_ms = timings.median_us / 1'000.0;
+    result.throughput_gb_s = dae::bench::gb_per_second(result.size, timings.median_us);
+    return result;
+}
+
+auto columns(const BenchResult& r) -> std::vector<dae::bench::Column>
+{
+    return {
+        {"function", r.function},
+        {"implementation", r.implementation},
+        {"input", r.input},
+        {"size_bytes", r.size},
+        {"checksum", r.checksum},
+        {"iterations", r.iterations},
+        {"min_ms", r.min_ms},
+        {"median_ms", r.median_ms},
+        {"throughput_gb_s", r.throughput_gb_s},
+    };
+}
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    BenchOptions options;
+    const bool parsed = dae::bench::Options("daedalus_whitespace_bench")
+                            .number("--size", "BYTES", options.size)
+                            .number("--iterations", "N", options.iterations)
+                            .flag("--json", options.json)
+                            .parse(argc, argv);
+    if (!parsed)
+    {
+        return 1;
+    }
+
+    std::mt19937_64 random(0xDAEDA105);
+    std::vector<BenchResult> results;
+    const std::vector<kernels::KernelSet> kernel_sets = kernels::get_supported_kernels();
+    std::fprintf(stderr, "dispatching to %s\n", kernels::get_kernels().name);
+
+    struct Input
+    {
+        std::string_view name;
+        uint64_t mean_padding;
+    };
+    for (const Input& input : {Input{.name = "padding 2", .mean_padding = 2},
+                               Input{.name = "padding 64", .mean_padding = 64},
+                               Input{.name = "padding 1024", .mean_padding = 1024}})
+    {
+        std::fprintf(stderr, "%.*s\n", static_cast<int>(input.name.size()), input.name.data());
+        const Fields fields = generate_fields(input.name, options.size, input.mean_padding, true, random);
+        auto bench = [&](std::string_view function, std::string_view implementation, auto&& run) -> void {
+            results.push_back(measure(function, implementation, fields, options.iterations, run));
+        };
+
+        bench("trim", "baseline", [&]() -> uint64_t { return trim_fields(fields, trim_baseline); });
+        for (const kernels::KernelSet& kernel_set : kernel_sets)
+        {
+            bench("trim", kernel_set.name, [&]() -> uint64_t {
+                return trim_fields(fields, [&](std::string_view sv) -> std::string_view {
+                    const size_t front = kernel_set.skip_whitespace(sv.data(), sv.size());
+                    if (front == sv.size())
+                        return {};
+                    return sv.substr(front, kernel_set.skip_whitespace_back(sv.data(), sv.size()) - front);
+                });
+            });
+        }
+        bench("trim", "dispatch", [&]() -> uint64_t { return trim_fields(fields, dae::strings::trim); });
+
+        std::vector<std::string_view> trimmed(fields.views.size());
+        bench("trim_all", "dispatch", [&]() -> uint64_t {
+            std::ranges::copy(fields.views, trimmed.begin());
+            dae::strings::trim_all(trimmed);
+            uint64_t size = 0;
+            for (std::string_view sv : trimmed)
+            {
+                size += sv.size();
+            }
+            return size;
+        });
+    }
+
+    for (const Input& input : {Input{.name = "whitespace 16", .mean_padding = 8},
+                               Input{.name = "whitespace 256", .mean_padding = 128},
+                               Input{.name = "whitespace 4096", .mean_padding = 2048}})
+    {
+        std::fprintf(stderr, "%.*s\n", static_cast<int>(input.name.size()), input.name.data());
+        const Fields fields = generate_fields(input.name, options.size, input.mean_padding, false, random);
+        auto bench = [&](std::string_view function, std::string_view implementation, auto&& run) -> void {
+            results.push_back(measure(function, implementation, fields, options.iterations, run));
+        };
+
+        bench("is_all_whitespace", "baseline", [&]() -> uint64_t {
+            return count_whitespace_fields(fields, is_all_whitespace_baseline);
+        });
+        for (const kernels::KernelSet& kernel_set : kernel_sets)
+        {
+            bench("is_all_whitespace", kernel_set.name, [&]() -> uint64_t {
+                return count_whitespace_fields(fields, [&](std::string_view sv) -> bool {
+                    return kernel_set.skip_whitespace(sv.data(), sv.size()) == sv.size();
+                });
+            });
+        }
+        bench("is_all_whitespace", "dispatch", [&]() -> uint64_t {
+            return count_whitespace_fields(fields, dae::strings::is_all_whitespace);
+        });
+    }
+
+    dae::bench::print_results(results, options.json, columns);
+    return 0;
+}
@@ -49,6 +49,18 @@
 #define ABSL_ATTRIBUTE_NOINLINE
 #endif
 
+// DAEDALUS_ATTRIBUTE_TARGET
+//
+// Compiles a single function for instruction set extensions that the rest of the
+// program is not built for, so that it can be called after checking for them at
+// runtime with `dae::get_cpu_features()`. MSVC allows intrinsics in any function,
+// so there this expands to nothing.
+#if ABSL_HAVE_ATTRIBUTE(target)
+#define DAEDALUS_ATTRIBUTE_TARGET(x) __attribute__((target(x)))
+#else
+#define DAEDALUS_ATTRIBUTE_TARGET(x)
+#endif
+
 #ifdef _MSC_VER
 #define NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
 #else
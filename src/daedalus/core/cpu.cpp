@@ -0,0 +1,118 @@
+#include "daedalus/core/cpu.h"
+
+#include <array>
+#include <cstdint>
+
+#if defined(DAEDALUS_ARCH_X86_64) && defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(DAEDALUS_ARCH_X86_64)
+#include <cpuid.h>
+#elif defined(DAEDALUS_ARCH_ARM64) && defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#elif defined(DAEDALUS_ARCH_ARM64) && defined(__linux__)
+#include <sys/auxv.h>
+#endif
+
+namespace dae
+{
+
+namespace
+{
+#if defined(DAEDALUS_ARCH_X86_64)
+// XCR0 bits for the SSE and AVX register state
+constexpr uint64_t XCR0_AVX = 0x6;
+// XCR0 bits for the SSE, AVX and AVX-512 register state
+constexpr uint64_t XCR0_AVX512 = 0xE6;
+
+/**
+ * @brief Runs `cpuid` for a leaf and subleaf.
+ *
+ * @return The eax, ebx, ecx and edx registers, or all zeros if the leaf is not supported.
+ */
+auto cpuid(uint32_t leaf, uint32_t subleaf) -> std::array<uint32_t, 4>
+{
+    std::array<uint32_t, 4> registers{};
+#ifdef _MSC_VER
+    std::array<int, 4> values{};
+    __cpuid(values.data(), 0);
+    if (static_cast<uint32_t>(values[0]) < leaf)
+    {
+        return registers;
+    }
+    __cpuidex(values.data(), static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (size_t i = 0; i < registers.size(); i++)
+    {
+        registers[i] = static_cast<uint32_t>(values[i]);
+    }
+#else
+    __get_cpuid_count(leaf, subleaf, &registers[0], &registers[1], &registers[2], &registers[3]);
+#endif
+    return registers;
+}
+
+/**
+ * @brief Reads XCR0, which says which register state the operating system saves on context switches.
+ */
+auto xgetbv() -> uint64_t
+{
+#ifdef _MSC_VER
+    return _xgetbv(0);
+#else
+    uint32_t eax = 0;
+    uint32_t edx = 0;
+    __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+auto detect_cpu_features() -> CpuFeatures
+{
+    CpuFeatures features;
+
+    const std::array<uint32_t, 4> leaf1 = cpuid(1, 0);
+    const uint32_t ecx1 = leaf1[2];
+    features.sse42 = (ecx1 & (1U << 20)) != 0;
+    features.pclmul = (ecx1 & (1U << 1)) != 0;
+
+    // AVX registers are only usable if the operating system has opted in to saving them
+    const bool osxsave = (ecx1 & (1U << 27)) != 0;
+    const uint64_t xcr0 = osxsave ? xgetbv() : 0;
+
+    const std::array<uint32_t, 4> leaf7 = cpuid(7, 0);
+    const uint32_t ebx7 = leaf7[1];
+    features.avx2 = (xcr0 & XCR0_AVX) == XCR0_AVX && (ebx7 & (1U << 5)) != 0;
+    features.avx512bw =
+        (xcr0 & XCR0_AVX512) == XCR0_AVX512 && (ebx7 & (1U << 16)) != 0 && (ebx7 & (1U << 30)) != 0;
+    return features;
+}
+#elif defined(DAEDALUS_ARCH_ARM64)
+auto detect_cpu_features() -> CpuFeatures
+{
+    CpuFeatures features;
+    features.neon = true;
+#if defined(_WIN32)
+    features.arm_crc32 = IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE) != FALSE;
+#elif defined(__linux__)
+    // HWCAP_CRC32 from <asm/hwcap.h>, which not every libc pulls in
+    constexpr unsigned long HWCAP_CRC32_BIT = 1UL << 7;
+    features.arm_crc32 = (getauxval(AT_HWCAP) & HWCAP_CRC32_BIT) != 0;
+#endif
+    return features;
+}
+#else
+auto detect_cpu_features() -> CpuFeatures
+{
+    return CpuFeatures{};
+}
+#endif
+} // namespace
+
+auto get_cpu_features() -> const CpuFeatures&
+{
+    static const CpuFeatures features = detect_cpu_features();
+    return features;
+}
+
+} // namespace dae
@@ -0,0 +1,57 @@
+#ifndef DAEDALUS_CORE_CPU_H
+#define DAEDALUS_CORE_CPU_H
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define DAEDALUS_ARCH_X86_64 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define DAEDALUS_ARCH_ARM64 1
+#endif
+
+namespace dae
+{
+
+/**
+ * @brief Instruction set extensions that daedalus has faster paths for. Extensions that do not exist on the current
+ * architecture are always false.
+ */
+struct CpuFeatures
+{
+    /**
+     * @brief x86 SSE4.2, which includes the CRC32C instructions.
+     */
+    bool sse42{false};
+    /**
+     * @brief x86 carry-less multiplication.
+     */
+    bool pclmul{false};
+    /**
+     * @brief x86 AVX2. Only set if the operating system also saves the AVX registers on context switches.
+     */
+    bool avx2{false};
+    /**
+     * @brief x86 AVX-512 Foundation and Byte/Word. Only set if the operating system also saves the AVX-512 registers
+     * on context switches.
+     */
+    bool avx512bw{false};
+    /**
+     * @brief ARM Advanced SIMD. Always set on ARM64.
+     */
+    bool neon{false};
+    /**
+     * @brief ARMv8 CRC32 and CRC32C instructions.
+     */
+    bool arm_crc32{false};
+};
+
+/**
+ * @brief Gets the instruction set extensions supported by the CPU the program is running on.
+ *
+ * @note The CPU is queried once, on the first call. Later calls are a load of a static.
+ *
+ * @return The supported extensions.
+ */
+[[nodiscard]] auto get_cpu_features() -> const CpuFeatures&;
+
+} // namespace dae
+
+#endif
@@ -13,12 +13,21 @@
 
 // core
 #include "daedalus/core/attributes.h"
+#include "daedalus/core/cpu.h"
 
 // debugging
 #include "daedalus/debugging/lifetime.h"
 
 // io
+#include "daedalus/io/archive.h"
+#include "daedalus/io/buffer_pool.h"
+#include "daedalus/io/cache.h"
+#include "daedalus/io/checksum.h"
+#include "daedalus/io/directory.h"
 #include "daedalus/io/file.h"
+#include "daedalus/io/file_cache.h"
+#include "daedalus/io/file_watcher.h"
+#include "daedalus/io/stream.h"
 
 // math
 #include "daedalus/math/math.h"
@@ -27,6 +36,11 @@
 #include "daedalus/profiling/timer.h"
 
 // strings
+#include "daedalus/strings/csv.h"
+#include "daedalus/strings/interner.h"
+#include "daedalus/strings/line_index.h"
+#include "daedalus/strings/parse.h"
+#include "daedalus/strings/split_view.h"
 #include "daedalus/strings/utils.h"
 
 // threading
@@ -0,0 +1,367 @@
+#include "daedalus/io/archive.h"
+
+#include "daedalus/math/math.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <utility>
+
+namespace dae::io
+{
+
+namespace
+{
+constexpr std::array<char, 8> ARCHIVE_MAGIC{'D', 'A', 'E', 'A', 'R', 'C', 'H', '\0'};
+constexpr uint32_t ARCHIVE_VERSION = 1;
+
+// The table of contents only starts on an 8 byte boundary, which is all its own fields need
+constexpr uint64_t TOC_ALIGNMENT = 8;
+
+/**
+ * @brief The start of every archive.
+ */
+struct ArchiveHeader
+{
+    std::array<char, 8> magic{};
+    uint32_t version{0};
+    uint32_t reserved{0};
+    uint64_t alignment{0};
+    uint64_t entry_count{0};
+    /**
+     * @brief The number of slots in the name hash table. Always a power of two, and at least twice the entry count so
+     * probes stay short.
+     */
+    uint64_t bucket_count{0};
+    /**
+     * @brief Where the table of contents starts. It holds `entry_count` ArchiveTocEntry, then `bucket_count` uint32_t
+     * hash table slots, then `names_size` bytes of names.
+     */
+    uint64_t toc_offset{0};
+    uint64_t names_size{0};
+    uint64_t reserved_2{0};
+};
+static_assert(sizeof(ArchiveHeader) == 64);
+
+/**
+ * @brief One file in the table of contents.
+ */
+struct ArchiveTocEntry
+{
+    uint64_t name_hash{0};
+    uint64_t offset{0};
+    uint64_t size{0};
+    uint32_t name_offset{0};
+    uint32_t name_length{0};
+};
+static_assert(sizeof(ArchiveTocEntry) == 32);
+
+/**
+ * @brief 64-bit FNV-1a. Stored in the archive, so it must never change for a given archive version.
+ */
+auto hash_name(std::string_view name) -> uint64_t
+{
+    uint64_t hash = 0xcbf29ce484222325;
+    for (char c : name)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+/**
+ * @brief Appends a trivially copyable value to the end of a byte buffer.
+ */
+template <typename T>
+auto append_bytes(std::vector<std::byte>& bytes, const T& value) -> void
+{
+    const size_t offset = bytes.size();
+    bytes.resize(offset + sizeof(T));
+    std::memcpy(bytes.data() + offset, &value, sizeof(T));
+}
+
+auto read_toc_entry(const std::byte* toc_entries, uint64_t index) -> ArchiveTocEntry
+{
+    ArchiveTocEntry entry{};
+    std::memcpy(&entry, toc_entries + (index * sizeof(ArchiveTocEntry)), sizeof(ArchiveTocEntry));
+    return entry;
+}
+} // namespace
+
+ArchiveBuilder::ArchiveBuilder(uint64_t alignment)
+    : alignment(std::bit_ceil(std::max<uint64_t>(alignment, 1))), contents(sizeof(ArchiveHeader))
+{
+}
+
+auto ArchiveBuilder::add(std::string_view name, std::span<const std::byte> data) -> bool
+{
+    if (!added_names.emplace(name).second)
+    {
+        return false;
+    }
+
+    const uint64_t offset = dae::align_up(contents.size(), alignment);
+    contents.resize(offset + data.size());
+    std::ranges::copy(data, contents.begin() + static_cast<ptrdiff_t>(offset));
+
+    entries.push_back(PendingEntry{
+        .name_hash = hash_name(name),
+        .offset = offset,
+        .size = data.size(),
+        .name_offset = static_cast<uint32_t>(names.size()),
+        .name_length = static_cast<uint32_t>(name.size()),
+    });
+    names.append(name);
+    return true;
+}
+
+auto ArchiveBuilder::add_file(std::string_view name, std::string_view file_path) -> bool
+{
+    if (added_names.contains(std::string(name)))
+    {
+        return false;
+    }
+
+    std::optional<File> file = load_file(file_path, FileLoadStrategy::AllowCached);
+    if (!file)
+    {
+        return false;
+    }
+
+    const bool added = add(name, get_file_data(file.value()));
+    free_file(file.value());
+    return added;
+}
+
+auto ArchiveBuilder::save(std::string_view archive_path, const FileSaveOptions& options) -> bool
+{
+    const uint64_t data_end = contents.size();
+    const uint64_t bucket_count = std::bit_ceil(std::max<uint64_t>(entries.size() * 2, 1));
+
+    // Linear probing, with each slot holding an entry index plus one so that zero can mean empty
+    std::vector<uint32_t> buckets(bucket_count, 0);
+    for (uint32_t i = 0; i < entries.size(); i++)
+    {
+        uint64_t slot = entries[i].name_hash & (bucket_count - 1);
+        while (buckets[slot] != 0)
+        {
+            slot = (slot + 1) & (bucket_count - 1);
+        }
+        buckets[slot] = i + 1;
+    }
+
+    const ArchiveHeader header{
+        .magic = ARCHIVE_MAGIC,
+        .version = ARCHIVE_VERSION,
+        .alignment = alignment,
+        .entry_count = entries.size(),
+        .bucket_count = bucket_count,
+        .toc_offset = dae::align_up(data_end, TOC_ALIGNMENT),
+        .names_size = names.size(),
+    };
+    std::memcpy(contents.data(), &header, sizeof(ArchiveHeader));
+
+    contents.resize(header.toc_offset);
+    for (const PendingEntry& entry : entries)
+    {
+        append_bytes(contents,
+                     ArchiveTocEntry{
+                         .name_hash = entry.name_hash,
+                         .offset = entry.offset,
+                         .size = entry.size,
+                         .name_offset = entry.name_offset,
+                         .name_length = entry.name_length,
+                     });
+    }
+    for (uint32_t bucket : buckets)
+    {
+        append_bytes(contents, bucket);
+    }
+    contents.resize(contents.size() + names.size());
+    std::memcpy(contents.data() + contents.size() - names.size(), names.data(), names.size());
+
+    const bool saved = save_file(archive_path, contents, options);
+
+    // Drop the table of contents again, so more files can still be added
+    contents.resize(data_end);
+    return saved;
+}
+
+auto ArchiveBuilder::entry_count() const -> uint64_t
+{
+    return entries.size();
+}
+
+ArchiveReader::~ArchiveReader()
+{
+    release();
+}
+
+ArchiveReader::ArchiveReader(ArchiveReader&& other) noexcept
+    : mapping(std::exchange(other.mapping, {})), archive_alignment(other.archive_alignment), count(other.count),
+      bucket_count(other.bucket_count), toc_entries(std::exchange(other.toc_entries, nullptr)),
+      buckets(std::exchange(other.buckets, nullptr)), names(std::exchange(other.names, nullptr))
+{
+}
+
+auto ArchiveReader::operator=(ArchiveReader&& other) noexcept -> ArchiveReader&
+{
+    if (this != &other)
+    {
+        release();
+        mapping = std::exchange(other.mapping, {});
+        archive_alignment = other.archive_alignment;
+        count = other.count;
+        bucket_count = other.bucket_count;
+        toc_entries = std::exchange(other.toc_entries, nullptr);
+        buckets = std::exchange(other.buckets, nullptr);
+        names = std::exchange(other.names, nullptr);
+    }
+    return *this;
+}
+
+auto ArchiveReader::open(std::string_view archive_path, MappedLoadHint hint) -> std::optional<ArchiveReader>
+{
+    std::optional<File> mapping = load_file_mapped(archive_path, hint);
+    if (!mapping)
+    {
+        return std::nullopt;
+    }
+
+    ArchiveReader reader;
+    reader.mapping = mapping.value();
+
+    const std::span<const std::byte> bytes = get_file_data(reader.mapping);
+    ArchiveHeader header{};
+    if (bytes.size() < sizeof(ArchiveHeader))
+    {
+        return std::nullopt;
+    }
+    std::memcpy(&header, bytes.data(), sizeof(ArchiveHeader));
+
+    // Every size is checked against the mapping before anything is read through it, so a truncated or corrupt archive
+    // is rejected here rather than crashing a later lookup
+    if (header.magic != ARCHIVE_MAGIC || header.version != ARCHIVE_VERSION || !std::has_single_bit(header.alignment) ||
+        !std::has_single_bit(header.bucket_count) || header.bucket_count / 2 < header.entry_count ||
+        header.toc_offset % TOC_ALIGNMENT != 0 || header.toc_offset > bytes.size())
+    {
+        return std::nullopt;
+    }
+
+    uint64_t toc_remaining = bytes.size() - header.toc_offset;
+    if (header.entry_count > toc_remaining / sizeof(ArchiveTocEntry))
+    {
+        return std::nullopt;
+    }
+    const uint64_t toc_entries_size = header.entry_count * sizeof(ArchiveTocEntry);
+    toc_remaining -= toc_entries_size;
+    if (header.bucket_count > toc_remaining / sizeof(uint32_t))
+    {
+        return std::nullopt;
+    }
+    const uint64_t buckets_size = header.bucket_count * sizeof(uint32_t);
+    toc_remaining -= buckets_size;
+    if (header.names_size > toc_remaining)
+    {
+        return std::nullopt;
+    }
+
+    reader.archive_alignment = header.alignment;
+    reader.count = header.entry_count;
+    reader.bucket_count = header.bucket_count;
+    reader.toc_entries = bytes.data() + header.toc_offset;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    reader.buckets = reinterpret_cast<const uint32_t*>(reader.toc_entries + toc_entries_size);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    reader.names = reinterpret_cast<const char*>(reader.toc_entries + toc_entries_size + buckets_size);
+
+    for (uint64_t i = 0; i < reader.count; i++)
+    {
+        const ArchiveTocEntry entry = read_toc_entry(reader.toc_entries, i);
+        if (entry.offset > header.toc_offset || entry.size > header.toc_offset - entry.offset ||
+            static_cast<uint64_t>(entry.name_offset) + entry.name_length > header.names_size)
+        {
+            return std::nullopt;
+        }
+    }
+
+    return reader;
+}
+
+auto ArchiveReader::find(std::string_view name) const -> std::optional<ArchiveEntry>
+{
+    const uint64_t hash = hash_name(name);
+    uint64_t slot = hash & (bucket_count - 1);
+
+    // Bounded by the table size in case of a hand-crafted archive with no empty slots
+    for (uint64_t probes = 0; probes < bucket_count; probes++)
+    {
+        const uint32_t bucket = buckets[slot];
+        if (bucket == 0 || bucket > count)
+        {
+            return std::nullopt;
+        }
+
+        const ArchiveTocEntry entry = read_toc_entry(toc_entries, bucket - 1);
+        if (entry.name_hash == hash && std::string_view(names + entry.name_offset, entry.name_length) == name)
+        {
+            return ArchiveEntry{
+                .name = std::string_view(names + entry.name_offset, entry.name_length),
+                .offset = entry.offset,
+                .size = entry.size,
+            };
+        }
+
+        slot = (slot + 1) & (bucket_count - 1);
+    }
+
+    return std::nullopt;
+}
+
+auto ArchiveReader::get_data(std::string_view name) const -> std::optional<std::span<const std::byte>>
+{
+    std::optional<ArchiveEntry> entry = find(name);
+    if (!entry)
+    {
+        return std::nullopt;
+    }
+    return get_data(entry.value());
+}
+
+auto ArchiveReader::get_data(const ArchiveEntry& entry) const -> std::span<const std::byte>
+{
+    return get_file_data(mapping).subspan(entry.offset, entry.size);
+}
+
+auto ArchiveReader::get_entry(uint64_t index) const -> ArchiveEntry
+{
+    const ArchiveTocEntry entry = read_toc_entry(toc_entries, index);
+    return ArchiveEntry{
+        .name = std::string_view(names + entry.name_offset, entry.name_length),
+        .offset = entry.offset,
+        .size = entry.size,
+    };
+}
+
+auto ArchiveReader::entry_count() const -> uint64_t
+{
+    return count;
+}
+
+auto ArchiveReader::alignment() const -> uint64_t
+{
+    return archive_alignment;
+}
+
+auto ArchiveReader::release() -> void
+{
+    if (mapping.buffer != nullptr)
+    {
+        free_file(mapping);
+        mapping = File{};
+    }
+}
+
+} // namespace dae::io
@@ -0,0 +1,190 @@
+#ifndef DAEDALUS_IO_ARCHIVE_H
+#define DAEDALUS_IO_ARCHIVE_H
+
+#include "daedalus/io/file.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace dae::io
+{
+
+/**
+ * @brief One file stored in an archive.
+ */
+struct ArchiveEntry
+{
+    /**
+     * @brief The name the file was added under. Points into the archive's mapping.
+     */
+    std::string_view name;
+    /**
+     * @brief Where the file's data starts in the archive. Always a multiple of the archive's alignment.
+     */
+    uint64_t offset{0};
+    uint64_t size{0};
+};
+
+/**
+ * @brief Packs many files into one archive, so they can be loaded without paying for an open and close per file.
+ *
+ * The archive is a header, followed by each file's data starting on an alignment boundary, followed by a table of
+ * contents. The table of contents is an open-addressed hash table of names, so `ArchiveReader::find()` takes constant
+ * time no matter how many files are in the archive.
+ *
+ * @note The archive is built up in memory and written out in one go by `save()`. Archives are written in the byte order
+ * of the machine building them, which is little-endian on every platform Daedalus supports.
+ */
+class ArchiveBuilder
+{
+  public:
+    /**
+     * @param alignment The boundary each file's data starts on. Use the `FileMetaData::alignment` of the filesystem
+     * the archive will be read from to allow reading single files with FileLoadStrategy::SafeDirectDisk. Rounded up
+     * to a power of two.
+     */
+    explicit ArchiveBuilder(uint64_t alignment = 4096);
+
+    /**
+     * @brief Adds a file's data to the archive.
+     *
+     * @param name The name to look the file up by.
+     * @param data The file's data, which is copied into the archive.
+     *
+     * @return False if a file with the same name has already been added.
+     */
+    auto add(std::string_view name, std::span<const std::byte> data) -> bool;
+
+    /**
+     * @brief Loads a file from disk and adds it to the archive.
+     *
+     * @param name The name to look the file up by.
+     * @param file_path The path of the file to add.
+     *
+     * @return False if the file could not be loaded, or if a file with the same name has already been added.
+     */
+    auto add_file(std::string_view name, std::string_view file_path) -> bool;
+
+    /**
+     * @brief Writes the archive out with its table of contents.
+     *
+     * @param archive_path The path to write the archive to.
+     * @param options Settings for the write strategy, atomic replacement and syncing.
+     *
+     * @return True if the archive was written.
+     */
+    [[nodiscard]] auto save(std::string_view archive_path, const FileSaveOptions& options = {}) -> bool;
+
+    /**
+     * @brief The number of files added to the archive so far.
+     */
+    [[nodiscard]] auto entry_count() const -> uint64_t;
+
+  private:
+    struct PendingEntry
+    {
+        uint64_t name_hash{0};
+        uint64_t offset{0};
+        uint64_t size{0};
+        uint32_t name_offset{0};
+        uint32_t name_length{0};
+    };
+
+    uint64_t alignment;
+    /**
+     * @brief The archive up to the end of the last file's data, with space left at the front for the header.
+     */
+    std::vector<std::byte> contents;
+    std::vector<PendingEntry> entries;
+    std::string names;
+    std::unordered_set<std::string> added_names;
+};
+
+/**
+ * @brief Reads an archive written by ArchiveBuilder. The archive is mapped rather than loaded, and files are returned
+ * as views straight into the mapping, so reading a file from the archive costs no system calls or copies.
+ */
+class ArchiveReader
+{
+  public:
+    ~ArchiveReader();
+
+    ArchiveReader(const ArchiveReader& other) = delete;
+    auto operator=(const ArchiveReader& other) -> ArchiveReader& = delete;
+    ArchiveReader(ArchiveReader&& other) noexcept;
+    auto operator=(ArchiveReader&& other) noexcept -> ArchiveReader&;
+
+    /**
+     * @brief Maps an archive and checks its header.
+     *
+     * @param archive_path The path to the archive.
+     * @param hint Guidance on whether to fault the archive's pages in lazily or eagerly.
+     *
+     * @return An ArchiveReader if the archive could be mapped and is valid, std::nullopt otherwise.
+     */
+    [[nodiscard]] static auto open(std::string_view archive_path, MappedLoadHint hint = MappedLoadHint::Lazy)
+        -> std::optional<ArchiveReader>;
+
+    /**
+     * @brief Looks up a file in the archive by name.
+     *
+     * @note The entry's offset and size can also be passed to `daedalus::fileio::load_file_range()`, to read the file
+     * into a buffer of its own, including with FileLoadStrategy::SafeDirectDisk.
+     *
+     * @return The file's entry, or std::nullopt if there is no file with that name.
+     */
+    [[nodiscard]] auto find(std::string_view name) const -> std::optional<ArchiveEntry>;
+
+    /**
+     * @brief Gets a view of a file's data in the archive by name. The view is valid for as long as the reader is.
+     *
+     * @return The file's data, or std::nullopt if there is no file with that name.
+     */
+    [[nodiscard]] auto get_data(std::string_view name) const -> std::optional<std::span<const std::byte>>;
+
+    /**
+     * @brief Gets a view of a file's data in the archive from its entry.
+     */
+    [[nodiscard]] auto get_data(const ArchiveEntry& entry) const -> std::span<const std::byte>;
+
+    /**
+     * @brief Gets an entry by its index, in the order files were added to the archive.
+     */
+    [[nodiscard]] auto get_entry(uint64_t index) const -> ArchiveEntry;
+
+    /**
+     * @brief The number of files in the archive.
+     */
+    [[nodiscard]] auto entry_count() const -> uint64_t;
+
+    /**
+     * @brief The boundary each file's data starts on.
+     */
+    [[nodiscard]] auto alignment() const -> uint64_t;
+
+  private:
+    ArchiveReader() = default;
+
+    auto release() -> void;
+
+    File mapping{};
+    uint64_t archive_alignment{0};
+    uint64_t count{0};
+    uint64_t bucket_count{0};
+    /**
+     * @brief Views of the table of contents, inside the mapping.
+     */
+    const std::byte* toc_entries{nullptr};
+    const uint32_t* buckets{nullptr};
+    const char* names{nullptr};
+};
+
+} // namespace dae::io
+
+#endif
@@ -0,0 +1,102 @@
+#include "daedalus/io/buffer_pool.h"
+
+#include <algorithm>
+#include <bit>
+#include <new>
+
+namespace dae::io
+{
+
+namespace
+{
+// Small buffers all share one bucket, as there is nothing to be gained from splitting them finer.
+constexpr uint64_t MIN_BUCKET_CAPACITY = 4096;
+} // namespace
+
+FileBufferPool::FileBufferPool(uint64_t max_bytes_held) : max_bytes_held(max_bytes_held)
+{
+}
+
+FileBufferPool::~FileBufferPool()
+{
+    trim();
+}
+
+auto FileBufferPool::acquire(uint64_t size, uint64_t alignment) -> void*
+{
+    const Bucket bucket = get_bucket(size, alignment);
+
+    {
+        std::lock_guard lock(mutex);
+        auto it = free_buffers.find(get_bucket_key(bucket));
+        if (it != free_buffers.end() && !it->second.empty())
+        {
+            void* buffer = it->second.back();
+            it->second.pop_back();
+            counters.hits++;
+            counters.buffers_held--;
+            counters.bytes_held -= bucket.capacity;
+            return buffer;
+        }
+        counters.misses++;
+    }
+
+    return ::operator new(bucket.capacity, std::align_val_t(bucket.alignment));
+}
+
+auto FileBufferPool::release(void* buffer, uint64_t size, uint64_t alignment) -> void
+{
+    const Bucket bucket = get_bucket(size, alignment);
+
+    {
+        std::lock_guard lock(mutex);
+        if (counters.bytes_held + bucket.capacity <= max_bytes_held)
+        {
+            free_buffers[get_bucket_key(bucket)].push_back(buffer);
+            counters.buffers_held++;
+            counters.bytes_held += bucket.capacity;
+            return;
+        }
+    }
+
+    ::operator delete(buffer, std::align_val_t(bucket.alignment));
+}
+
+auto FileBufferPool::trim() -> void
+{
+    std::lock_guard lock(mutex);
+    for (auto& [key, buffers] : free_buffers)
+    {
+        const uint64_t alignment = uint64_t{1} << (key & 0xFF);
+        for (void* buffer : buffers)
+        {
+            ::operator delete(buffer, std::align_val_t(alignment));
+        }
+    }
+    free_buffers.clear();
+    counters.buffers_held = 0;
+    counters.bytes_held = 0;
+}
+
+auto FileBufferPool::stats() const -> FileBufferPoolStats
+{
+    std::lock_guard lock(mutex);
+    return counters;
+}
+
+auto FileBufferPool::get_bucket(uint64_t size, uint64_t alignment) -> Bucket
+{
+    const uint64_t bucket_alignment =
+        std::bit_ceil(std::max<uint64_t>(alignment, __STDCPP_DEFAULT_NEW_ALIGNMENT__));
+    return Bucket{
+        .capacity = std::bit_ceil(std::max({size, bucket_alignment, MIN_BUCKET_CAPACITY})),
+        .alignment = bucket_alignment,
+    };
+}
+
+auto FileBufferPool::get_bucket_key(const Bucket& bucket) -> uint32_t
+{
+    return static_cast<uint32_t>((std::countr_zero(bucket.capacity) << 8) | std::countr_zero(bucket.alignment));
+}
+
+} // namespace dae::io
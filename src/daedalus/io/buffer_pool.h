@@ -0,0 +1,96 @@
+#ifndef DAEDALUS_IO_BUFFER_POOL_H
+#define DAEDALUS_IO_BUFFER_POOL_H
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace dae::io
+{
+
+/**
+ * @brief Counters describing how well a FileBufferPool is being reused.
+ */
+struct FileBufferPoolStats
+{
+    uint64_t hits{0};
+    uint64_t misses{0};
+    uint64_t bytes_held{0};
+    uint64_t buffers_held{0};
+};
+
+/**
+ * @brief A thread-safe pool of file buffers, so that repeatedly loading files does not pay for a fresh allocation and
+ * fresh page faults on every load.
+ *
+ * Buffers are bucketed by their size rounded up to a power of two, and by their alignment. Buffers returned to the
+ * pool are held for reuse until holding them would go over the pool's memory cap, after which they are freed instead.
+ *
+ * @note Pass a pool to `daedalus::fileio::load_file()` to draw the File's buffer from it.
+ * `daedalus::fileio::free_file()` then returns the buffer to the pool, so the pool must outlive every File loaded from
+ * it.
+ */
+class FileBufferPool
+{
+  public:
+    /**
+     * @param max_bytes_held The most bytes of unused buffers the pool will hold on to.
+     */
+    explicit FileBufferPool(uint64_t max_bytes_held = static_cast<uint64_t>(256) * 1024 * 1024);
+    ~FileBufferPool();
+
+    FileBufferPool(const FileBufferPool& other) = delete;
+    auto operator=(const FileBufferPool& other) -> FileBufferPool& = delete;
+    FileBufferPool(FileBufferPool&& other) noexcept = delete;
+    auto operator=(FileBufferPool&& other) noexcept -> FileBufferPool& = delete;
+
+    /**
+     * @brief Gets a buffer of at least `size` bytes, reusing a held buffer from the same bucket if there is one.
+     *
+     * @param size The size the buffer needs to be.
+     * @param alignment The alignment the buffer needs to have.
+     *
+     * @return The buffer. Must be given back with `release()` using the same size and alignment.
+     */
+    [[nodiscard]] auto acquire(uint64_t size, uint64_t alignment) -> void*;
+
+    /**
+     * @brief Gives a buffer back to the pool.
+     *
+     * @param buffer The buffer, from `acquire()`.
+     * @param size The size passed to `acquire()`.
+     * @param alignment The alignment passed to `acquire()`.
+     */
+    auto release(void* buffer, uint64_t size, uint64_t alignment) -> void;
+
+    /**
+     * @brief Frees every buffer the pool is holding on to.
+     */
+    auto trim() -> void;
+
+    /**
+     * @brief Gets the pool's reuse counters.
+     */
+    [[nodiscard]] auto stats() const -> FileBufferPoolStats;
+
+  private:
+    struct Bucket
+    {
+        uint64_t capacity{0};
+        uint64_t alignment{0};
+    };
+
+    static auto get_bucket(uint64_t size, uint64_t alignment) -> Bucket;
+    static auto get_bucket_key(const Bucket& bucket) -> uint32_t;
+
+    const uint64_t max_bytes_held;
+
+    mutable std::mutex mutex;
+    std::unordered_map<uint32_t, std::vector<void*>> free_buffers;
+    FileBufferPoolStats counters{};
+};
+
+} // namespace dae::io
+
+#endif
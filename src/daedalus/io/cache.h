@@ -0,0 +1,74 @@
+#ifndef DAEDALUS_IO_CACHE_H
+#define DAEDALUS_IO_CACHE_H
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace dae::io
+{
+
+/**
+ * @brief How much of a file is currently held in the operating system's filesystem cache.
+ */
+struct FileResidency
+{
+    uint64_t size{0};
+    uint64_t resident_bytes{0};
+};
+
+/**
+ * @brief Asks the operating system to start reading a whole file into its filesystem cache, so that a later load with
+ * FileLoadStrategy::AllowCached or FileLoadStrategy::Mapped hits memory instead of the disk.
+ *
+ * @note This is a hint. The readahead may be partial, and the pages may be evicted again before they are used.
+ *
+ * @param file_path The path to the file.
+ *
+ * @return Whether the prefetch could be requested.
+ */
+auto prefetch_file(std::string_view file_path) -> bool;
+
+/**
+ * @brief Asks the operating system to start reading one region of a file into its filesystem cache.
+ *
+ * @param file_path The path to the file.
+ * @param offset The offset of the region in the file.
+ * @param length The length of the region. Regions that run past the end of the file are cut short.
+ *
+ * @return Whether the prefetch could be requested.
+ */
+auto prefetch_range(std::string_view file_path, uint64_t offset, uint64_t length) -> bool;
+
+/**
+ * @brief Asks the operating system to drop a file from its filesystem cache, so the next load has to go to disk.
+ *
+ * @note Only clean pages can be dropped. Recently written data stays cached until it has been written back, which
+ * `daedalus::fileio::save_file()` can force with FileSyncMode::Data.
+ *
+ * @note On Windows this opens the file without buffering, which makes the cache manager purge it. This has no effect
+ * while another handle to the file is open with buffering.
+ *
+ * @param file_path The path to the file.
+ *
+ * @return Whether the eviction could be requested.
+ */
+auto evict_file(std::string_view file_path) -> bool;
+
+/**
+ * @brief Measures how much of a file is in the filesystem cache. A mostly resident file is cheaper to load with
+ * FileLoadStrategy::AllowCached or FileLoadStrategy::Mapped, and a mostly cold one with
+ * FileLoadStrategy::SafeDirectDisk.
+ *
+ * @note On Linux this uses `cachestat` where the kernel has it (6.5 and later), and otherwise maps the file and counts
+ * its resident pages with `mincore`. Windows has no way to query this, and always returns std::nullopt.
+ *
+ * @param file_path The path to the file.
+ *
+ * @return The file's size and the number of its bytes that are cached, or std::nullopt if they cannot be measured.
+ */
+[[nodiscard]] auto get_file_residency(std::string_view file_path) -> std::optional<FileResidency>;
+
+} // namespace dae::io
+
+#endif
@@ -0,0 +1,297 @@
+#include "daedalus/io/checksum.h"
+
+#include "daedalus/core/attributes.h"
+#include "daedalus/core/cpu.h"
+
+#include <array>
+#include <bit>
+#include <cstring>
+
+#if defined(DAEDALUS_ARCH_X86_64)
+#include <nmmintrin.h>
+#define DAEDALUS_HAS_SSE42_CRC32C 1
+#elif defined(DAEDALUS_ARCH_ARM64) && defined(_MSC_VER)
+#include <intrin.h>
+#define DAEDALUS_HAS_ARM_CRC32C 1
+#elif defined(DAEDALUS_ARCH_ARM64) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define DAEDALUS_HAS_ARM_CRC32C 1
+#endif
+
+namespace dae::io
+{
+
+namespace
+{
+// The Castagnoli polynomial, bit-reversed
+constexpr uint32_t POLYNOMIAL = 0x82F63B78;
+
+// Streams are interleaved over lanes of this size. Long lanes amortize the cost of joining the streams back together,
+// and short lanes let smaller buffers use the interleaved loop too.
+constexpr size_t LONG_LANE_SIZE = 8192;
+constexpr size_t SHORT_LANE_SIZE = 256;
+
+using SliceTables = std::array<std::array<uint32_t, 256>, 8>;
+
+/**
+ * @brief Builds the tables for slicing-by-8, where table N advances a byte through N more bytes of zeros.
+ */
+constexpr auto make_slice_tables() -> SliceTables
+{
+    SliceTables tables{};
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ ((crc & 1) != 0 ? POLYNOMIAL : 0);
+        }
+        tables[0][i] = crc;
+    }
+    for (size_t slice = 1; slice < tables.size(); slice++)
+    {
+        for (size_t i = 0; i < 256; i++)
+        {
+            const uint32_t previous = tables[slice - 1][i];
+            tables[slice][i] = (previous >> 8) ^ tables[0][previous & 0xFF];
+        }
+    }
+    return tables;
+}
+
+constexpr SliceTables SLICE_TABLES = make_slice_tables();
+
+auto load_u64(const std::byte* data) -> uint64_t
+{
+    uint64_t value = 0;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Advances the CRC register over a block of data with slicing-by-8. The register is not inverted before or
+ * after, which is left to the caller.
+ */
+auto update_portable(uint32_t crc, const std::byte* data, size_t size) -> uint32_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-bounds-constant-array-index)
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        for (; size >= 8; data += 8, size -= 8)
+        {
+            const uint64_t value = load_u64(data) ^ crc;
+            const auto low = static_cast<uint32_t>(value);
+            const auto high = static_cast<uint32_t>(value >> 32);
+            crc = SLICE_TABLES[7][low & 0xFF] ^ SLICE_TABLES[6][(low >> 8) & 0xFF] ^
+                  SLICE_TABLES[5][(low >> 16) & 0xFF] ^ SLICE_TABLES[4][low >> 24] ^ SLICE_TABLES[3][high & 0xFF] ^
+                  SLICE_TABLES[2][(high >> 8) & 0xFF] ^ SLICE_TABLES[1][(high >> 16) & 0xFF] ^
+                  SLICE_TABLES[0][high >> 24];
+        }
+    }
+    for (; size > 0; data++, size--)
+    {
+        crc = (crc >> 8) ^ SLICE_TABLES[0][(crc ^ static_cast<uint32_t>(*data)) & 0xFF];
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-bounds-constant-array-index)
+    return crc;
+}
+
+#if defined(DAEDALUS_HAS_SSE42_CRC32C) || defined(DAEDALUS_HAS_ARM_CRC32C)
+/**
+ * @brief Advances a CRC register over a fixed number of zero bytes with four table lookups.
+ *
+ * The CRC register is linear over GF(2), so a register run through a block on its own, from zero, can be joined onto
+ * the register for the data before the block by advancing that one over the block's length in zeros and xoring the two.
+ * This is what lets independent streams over neighbouring lanes be joined back into one checksum.
+ */
+class LaneShift
+{
+  public:
+    explicit LaneShift(size_t lane_size) : lane_size(lane_size)
+    {
+        // Where each bit of the register ends up after the lane, found by running it through the lane byte by byte
+        std::array<uint32_t, 32> columns{};
+        for (size_t bit = 0; bit < columns.size(); bit++)
+        {
+            uint32_t crc = uint32_t{1} << bit;
+            for (size_t i = 0; i < lane_size; i++)
+            {
+                crc = (crc >> 8) ^ SLICE_TABLES[0][crc & 0xFF];
+            }
+            columns[bit] = crc;
+        }
+
+        for (size_t byte = 0; byte < tables.size(); byte++)
+        {
+            for (uint32_t value = 0; value < 256; value++)
+            {
+                uint32_t shifted = 0;
+                for (size_t bit = 0; bit < 8; bit++)
+                {
+                    if ((value & (1U << bit)) != 0)
+                    {
+                        shifted ^= columns[(byte * 8) + bit];
+                    }
+                }
+                tables[byte][value] = shifted;
+            }
+        }
+    }
+
+    [[nodiscard]] auto apply(uint32_t crc) const -> uint32_t
+    {
+        return tables[0][crc & 0xFF] ^ tables[1][(crc >> 8) & 0xFF] ^ tables[2][(crc >> 16) & 0xFF] ^
+               tables[3][crc >> 24];
+    }
+
+    const size_t lane_size;
+
+  private:
+    std::array<std::array<uint32_t, 256>, 4> tables{};
+};
+
+auto get_long_lane_shift() -> const LaneShift&
+{
+    static const LaneShift shift(LONG_LANE_SIZE);
+    return shift;
+}
+
+auto get_short_lane_shift() -> const LaneShift&
+{
+    static const LaneShift shift(SHORT_LANE_SIZE);
+    return shift;
+}
+#endif
+
+#if defined(DAEDALUS_HAS_SSE42_CRC32C)
+/**
+ * @brief Advances the CRC register over as many blocks of three lanes as fit in the data, one stream per lane.
+ *
+ * @note `crc32` has a latency of three cycles but can start one every cycle, so three independent streams keep it
+ * fully busy where one stream would leave it idle two cycles out of three.
+ */
+DAEDALUS_ATTRIBUTE_TARGET("sse4.2")
+auto update_lanes_sse42(uint32_t crc, const std::byte*& data, size_t& size, const LaneShift& shift) -> uint32_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const size_t lane = shift.lane_size;
+    for (; size >= 3 * lane; data += 3 * lane, size -= 3 * lane)
+    {
+        uint64_t crc0 = crc;
+        uint64_t crc1 = 0;
+        uint64_t crc2 = 0;
+        for (size_t i = 0; i < lane; i += 8)
+        {
+            crc0 = _mm_crc32_u64(crc0, load_u64(data + i));
+            crc1 = _mm_crc32_u64(crc1, load_u64(data + lane + i));
+            crc2 = _mm_crc32_u64(crc2, load_u64(data + (2 * lane) + i));
+        }
+        crc = shift.apply(shift.apply(static_cast<uint32_t>(crc0)) ^ static_cast<uint32_t>(crc1)) ^
+              static_cast<uint32_t>(crc2);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return crc;
+}
+
+DAEDALUS_ATTRIBUTE_TARGET("sse4.2")
+auto update_sse42(uint32_t crc, const std::byte* data, size_t size) -> uint32_t
+{
+    crc = update_lanes_sse42(crc, data, size, get_long_lane_shift());
+    crc = update_lanes_sse42(crc, data, size, get_short_lane_shift());
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    uint64_t crc64 = crc;
+    for (; size >= 8; data += 8, size -= 8)
+    {
+        crc64 = _mm_crc32_u64(crc64, load_u64(data));
+    }
+    crc = static_cast<uint32_t>(crc64);
+    for (; size > 0; data++, size--)
+    {
+        crc = _mm_crc32_u8(crc, static_cast<uint8_t>(*data));
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return crc;
+}
+#endif
+
+#if defined(DAEDALUS_HAS_ARM_CRC32C)
+/**
+ * @brief Advances the CRC register over as many blocks of three lanes as fit in the data, one stream per lane.
+ *
+ * @note `crc32cx` has a latency of several cycles but is pipelined, so independent streams keep it busy.
+ */
+auto update_lanes_arm(uint32_t crc, const std::byte*& data, size_t& size, const LaneShift& shift) -> uint32_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const size_t lane = shift.lane_size;
+    for (; size >= 3 * lane; data += 3 * lane, size -= 3 * lane)
+    {
+        uint32_t crc0 = crc;
+        uint32_t crc1 = 0;
+        uint32_t crc2 = 0;
+        for (size_t i = 0; i < lane; i += 8)
+        {
+            crc0 = __crc32cd(crc0, load_u64(data + i));
+            crc1 = __crc32cd(crc1, load_u64(data + lane + i));
+            crc2 = __crc32cd(crc2, load_u64(data + (2 * lane) + i));
+        }
+        crc = shift.apply(shift.apply(crc0) ^ crc1) ^ crc2;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return crc;
+}
+
+auto update_arm(uint32_t crc, const std::byte* data, size_t size) -> uint32_t
+{
+    crc = update_lanes_arm(crc, data, size, get_long_lane_shift());
+    crc = update_lanes_arm(crc, data, size, get_short_lane_shift());
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (; size >= 8; data += 8, size -= 8)
+    {
+        crc = __crc32cd(crc, load_u64(data));
+    }
+    for (; size > 0; data++, size--)
+    {
+        crc = __crc32cb(crc, static_cast<uint8_t>(*data));
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return crc;
+}
+#endif
+
+using UpdateFunction = uint32_t (*)(uint32_t, const std::byte*, size_t);
+
+/**
+ * @brief Picks the fastest implementation the CPU supports.
+ */
+auto select_update() -> UpdateFunction
+{
+#if defined(DAEDALUS_HAS_SSE42_CRC32C)
+    if (get_cpu_features().sse42)
+    {
+        return update_sse42;
+    }
+#elif defined(DAEDALUS_HAS_ARM_CRC32C)
+    if (get_cpu_features().arm_crc32)
+    {
+        return update_arm;
+    }
+#endif
+    return update_portable;
+}
+} // namespace
+
+auto crc32c(std::span<const std::byte> data, uint32_t crc) -> uint32_t
+{
+    static const UpdateFunction update = select_update();
+    return ~update(~crc, data.data(), data.size());
+}
+
+auto crc32c_portable(std::span<const std::byte> data, uint32_t crc) -> uint32_t
+{
+    return ~update_portable(~crc, data.data(), data.size());
+}
+
+} // namespace dae::io
@@ -0,0 +1,35 @@
+#ifndef DAEDALUS_IO_CHECKSUM_H
+#define DAEDALUS_IO_CHECKSUM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace dae::io
+{
+
+/**
+ * @brief Computes the CRC32C (Castagnoli) checksum of a block of data, as used by iSCSI, ext4, and most storage
+ * formats.
+ *
+ * Uses the CRC32C instructions from SSE4.2 on x86-64 and from the CRC extension on ARM64 when the CPU has them,
+ * running three independent streams at once to hide their latency, and a table-driven fallback otherwise. The path is
+ * chosen once, on the first call.
+ *
+ * @param data The data to checksum.
+ * @param crc The checksum of the data that came before, to checksum data that arrives in pieces. 0 to start a new
+ * checksum.
+ *
+ * @return The checksum of everything up to and including the data.
+ */
+[[nodiscard]] auto crc32c(std::span<const std::byte> data, uint32_t crc = 0) -> uint32_t;
+
+/**
+ * @brief Same as `crc32c()`, but always uses the table-driven fallback (slicing-by-8), never the CPU's CRC
+ * instructions.
+ */
+[[nodiscard]] auto crc32c_portable(std::span<const std::byte> data, uint32_t crc = 0) -> uint32_t;
+
+} // namespace dae::io
+
+#endif
@@ -0,0 +1,58 @@
+#include "daedalus/io/directory.h"
+
+#include <algorithm>
+
+namespace dae::io
+{
+
+auto DirectoryListing::get_path(const DirectoryEntry& entry) const -> std::string_view
+{
+    return std::string_view(path_arena.data() + entry.path_offset, entry.path_length);
+}
+
+auto DirectoryListing::get_name(const DirectoryEntry& entry) const -> std::string_view
+{
+    return get_path(entry).substr(entry.path_length - entry.name_length);
+}
+
+auto DirectoryListing::get_file_paths() const -> std::vector<std::string_view>
+{
+    std::vector<std::string_view> paths;
+    paths.reserve(entries.size());
+    for (const DirectoryEntry& entry : entries)
+    {
+        if (entry.type == DirectoryEntryType::File)
+        {
+            paths.push_back(get_path(entry));
+        }
+    }
+    return paths;
+}
+
+auto DirectoryListing::add_entry(std::string_view parent_path, std::string_view name, DirectoryEntryType type)
+    -> DirectoryEntry&
+{
+    const bool needs_separator = !parent_path.empty() && parent_path.back() != '/' && parent_path.back() != '\\';
+    const uint64_t path_offset = path_arena.size();
+    const uint64_t path_length = parent_path.size() + (needs_separator ? 1 : 0) + name.size();
+
+    path_arena.resize(path_offset + path_length + 1);
+    char* path = path_arena.data() + path_offset;
+    path = std::ranges::copy(parent_path, path).out;
+    if (needs_separator)
+    {
+        *path++ = '/';
+    }
+    path = std::ranges::copy(name, path).out;
+    *path = '\0';
+
+    return entries.emplace_back(DirectoryEntry{
+        .path_offset = path_offset,
+        .path_length = static_cast<uint32_t>(path_length),
+        .name_length = static_cast<uint32_t>(name.size()),
+        .size = 0,
+        .type = type,
+    });
+}
+
+} // namespace dae::io
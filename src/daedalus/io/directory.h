@@ -0,0 +1,125 @@
+#ifndef DAEDALUS_IO_DIRECTORY_H
+#define DAEDALUS_IO_DIRECTORY_H
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace dae::io
+{
+
+/**
+ * @brief The kind of filesystem object a DirectoryEntry refers to.
+ */
+enum class DirectoryEntryType : uint8_t
+{
+    Unknown = 0,
+    File,
+    Directory,
+    /**
+     * @brief A symbolic link, or on Windows any reparse point. Links are listed but never followed.
+     */
+    Symlink,
+    /**
+     * @brief Anything else, such as a device, socket or pipe.
+     */
+    Other,
+};
+
+/**
+ * @brief One entry of a DirectoryListing. Its path is stored in the listing's path arena, and is read back with
+ * `DirectoryListing::get_path()`.
+ */
+struct DirectoryEntry
+{
+    uint64_t path_offset{0};
+    uint32_t path_length{0};
+    uint32_t name_length{0};
+    /**
+     * @brief The size of the file in bytes. Only filled in for DirectoryEntryType::File entries, and on Linux only
+     * when DirectoryScanOptions::fetch_sizes is set.
+     */
+    uint64_t size{0};
+    DirectoryEntryType type{DirectoryEntryType::Unknown};
+};
+
+/**
+ * @brief Settings for `daedalus::fileio::scan_directory()`.
+ */
+struct DirectoryScanOptions
+{
+    /**
+     * @brief Descend into subdirectories.
+     */
+    bool recursive{true};
+    /**
+     * @brief List directories as entries of their own, as well as descending into them.
+     */
+    bool include_directories{false};
+    /**
+     * @brief Fill in DirectoryEntry::size for every file. On Linux this costs a `statx` per file, which are spread
+     * over `stat_thread_count` threads. Windows returns sizes with the listing itself, so they are always filled in.
+     */
+    bool fetch_sizes{false};
+    uint32_t stat_thread_count{4};
+};
+
+/**
+ * @brief The result of `daedalus::fileio::scan_directory()`. Every path is packed into one arena instead of being
+ * allocated on its own, so listing a large tree costs a handful of allocations rather than one per entry.
+ *
+ * @note Paths are the scanned directory joined with the entry's path inside it, using '/' as the separator on every
+ * platform. Each path is followed by a null terminator in the arena, so `get_path().data()` can be passed to C APIs.
+ */
+struct DirectoryListing
+{
+    std::vector<DirectoryEntry> entries;
+    std::vector<char> path_arena;
+
+    /**
+     * @brief Gets the full path of an entry.
+     */
+    [[nodiscard]] auto get_path(const DirectoryEntry& entry) const -> std::string_view;
+
+    /**
+     * @brief Gets the name of an entry, which is the last component of its path.
+     */
+    [[nodiscard]] auto get_name(const DirectoryEntry& entry) const -> std::string_view;
+
+    /**
+     * @brief Gets the paths of every DirectoryEntryType::File entry, ready to be passed to
+     * `daedalus::fileio::load_files()`. The views point into the arena, so the listing must outlive them.
+     */
+    [[nodiscard]] auto get_file_paths() const -> std::vector<std::string_view>;
+
+    /**
+     * @brief Appends an entry, copying `parent_path/name` into the arena.
+     *
+     * @note `parent_path` must not point into this listing's own arena, which may be reallocated by the append.
+     *
+     * @return The new entry.
+     */
+    auto add_entry(std::string_view parent_path, std::string_view name, DirectoryEntryType type) -> DirectoryEntry&;
+};
+
+/**
+ * @brief Lists the contents of a directory, and optionally of all of its subdirectories.
+ *
+ * On Linux this reads raw directory records with `getdents64` in large batches, and on Windows it uses
+ * `FindFirstFileEx` with large fetches. Neither goes through `std::filesystem`, and no allocation is made per entry.
+ *
+ * @note Entries are listed in the order the filesystem returns them, which is not sorted. Subdirectories that cannot
+ * be opened, for example because of their permissions, are skipped.
+ *
+ * @param directory_path The directory to scan.
+ * @param options Settings for recursion and size fetching.
+ *
+ * @return The listing, or std::nullopt if the directory itself could not be opened.
+ */
+[[nodiscard]] auto scan_directory(std::string_view directory_path, const DirectoryScanOptions& options = {})
+    -> std::optional<DirectoryListing>;
+
+} // namespace dae::io
+
+#endif
@@ -1,12 +1,350 @@
 #include "daedalus/io/file.h"
 
+#include "daedalus/io/buffer_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
 #include <filesystem>
+#include <future>
 #include <new>
+#include <string>
+#include <system_error>
 #include <utility>
 
+#ifdef _WIN32
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+
+#else
+
+#include <sys/mman.h>
+
+#endif
+
 namespace dae::io
 {
 
+namespace
+{
+// How long load_files() blocks on one load before checking the others again, when none of them are ready
+constexpr std::chrono::microseconds LOAD_FILES_POLL_INTERVAL{50};
+
+/**
+ * @brief A FileFuture::State for a load running on another thread behind a std::future.
+ */
+class FutureState final : public FileFuture::State
+{
+  public:
+    explicit FutureState(std::future<std::optional<File>> future) : future(std::move(future)) {}
+
+    auto is_ready() -> bool override
+    {
+        return wait_for(std::chrono::nanoseconds(0));
+    }
+
+    auto wait_for(std::chrono::nanoseconds timeout) -> bool override
+    {
+        if (future.wait_for(timeout) != std::future_status::ready)
+        {
+            return false;
+        }
+        // Take the result as soon as it is seen, so the progress can be reported
+        if (!result)
+        {
+            result = future.get();
+        }
+        return true;
+    }
+
+    auto cancel() -> bool override
+    {
+        return false;
+    }
+
+    auto bytes_transferred() const -> uint64_t override
+    {
+        return result && result.value() ? result.value()->bytes_read : 0;
+    }
+
+    auto bytes_total() const -> uint64_t override
+    {
+        return result && result.value() ? result.value()->buffer_size : 0;
+    }
+
+    auto get() -> std::optional<File> override
+    {
+        return result ? result.value() : future.get();
+    }
+
+  private:
+    std::future<std::optional<File>> future;
+    std::optional<std::optional<File>> result;
+};
+
+/**
+ * @brief A FileFuture::State for a load that has already finished.
+ */
+class ResultState final : public FileFuture::State
+{
+  public:
+    explicit ResultState(std::optional<File> file) : file(file) {}
+
+    auto is_ready() -> bool override
+    {
+        return true;
+    }
+
+    auto wait_for(std::chrono::nanoseconds /*timeout*/) -> bool override
+    {
+        return true;
+    }
+
+    auto cancel() -> bool override
+    {
+        return false;
+    }
+
+    auto bytes_transferred() const -> uint64_t override
+    {
+        return file ? file->bytes_read : 0;
+    }
+
+    auto bytes_total() const -> uint64_t override
+    {
+        return file ? file->buffer_size : 0;
+    }
+
+    auto get() -> std::optional<File> override
+    {
+        return file;
+    }
+
+  private:
+    std::optional<File> file;
+};
+} // namespace
+
+FileFuture::FileFuture(std::unique_ptr<State> state) : state(std::move(state))
+{
+}
+
+FileFuture::~FileFuture()
+{
+    release();
+}
+
+auto FileFuture::operator=(FileFuture&& other) noexcept -> FileFuture&
+{
+    if (this != &other)
+    {
+        release();
+        state = std::move(other.state);
+    }
+    return *this;
+}
+
+auto FileFuture::from_future(std::future<std::optional<File>> future) -> FileFuture
+{
+    return FileFuture(std::make_unique<FutureState>(std::move(future)));
+}
+
+auto FileFuture::from_result(std::optional<File> file) -> FileFuture
+{
+    return FileFuture(std::make_unique<ResultState>(file));
+}
+
+auto FileFuture::valid() const -> bool
+{
+    return state != nullptr;
+}
+
+auto FileFuture::is_ready() -> bool
+{
+    return state && state->is_ready();
+}
+
+auto FileFuture::wait_for(std::chrono::nanoseconds timeout) -> bool
+{
+    return state && state->wait_for(timeout);
+}
+
+auto FileFuture::cancel() -> bool
+{
+    return state && state->cancel();
+}
+
+auto FileFuture::bytes_transferred() const -> uint64_t
+{
+    return state ? state->bytes_transferred() : 0;
+}
+
+auto FileFuture::bytes_total() const -> uint64_t
+{
+    return state ? state->bytes_total() : 0;
+}
+
+auto FileFuture::get() -> std::optional<File>
+{
+    if (!state)
+    {
+        return std::nullopt;
+    }
+    std::optional<File> file = state->get();
+    state.reset();
+    return file;
+}
+
+auto FileFuture::operator()() -> std::optional<File>
+{
+    return get();
+}
+
+auto FileFuture::release() -> void
+{
+    if (!state)
+    {
+        return;
+    }
+
+    // The read has to land before its buffer can be freed
+    state->cancel();
+    std::optional<File> file = state->get();
+    if (file)
+    {
+        free_file(file.value());
+    }
+    state.reset();
+}
+
+auto load_files(std::span<const std::string_view> file_paths, FileLoadStrategy load_strategy, size_t queue_depth)
+    -> std::vector<std::optional<File>>
+{
+    std::vector<std::optional<File>> files(file_paths.size());
+    std::vector<std::pair<size_t, FileFuture>> in_flight;
+    queue_depth = std::max<size_t>(queue_depth, 1);
+    in_flight.reserve(queue_depth);
+
+    // The batch being opened on a worker thread, and where it starts in file_paths
+    std::future<std::vector<std::optional<FileFuture>>> opening;
+    size_t opening_start = 0;
+
+    size_t next = 0;
+    while (next < file_paths.size() || opening.valid() || !in_flight.empty())
+    {
+        // Open the next batch in the background, so that opening and statting files overlaps the reads in flight
+        if (!opening.valid() && next < file_paths.size() && in_flight.size() < queue_depth)
+        {
+            const size_t count = std::min(queue_depth - in_flight.size(), file_paths.size() - next);
+            opening = std::async(std::launch::async, load_files_async, file_paths.subspan(next, count), load_strategy);
+            opening_start = next;
+            next += count;
+        }
+
+        if (opening.valid() &&
+            (in_flight.empty() || opening.wait_for(std::chrono::seconds(0)) == std::future_status::ready))
+        {
+            std::vector<std::optional<FileFuture>> opened = opening.get();
+            for (size_t i = 0; i < opened.size(); i++)
+            {
+                if (opened[i])
+                {
+                    in_flight.emplace_back(opening_start + i, std::move(opened[i].value()));
+                }
+            }
+            continue;
+        }
+
+        // Collect whichever loads are done, in any order
+        const size_t before = in_flight.size();
+        for (size_t i = 0; i < in_flight.size();)
+        {
+            if (in_flight[i].second.is_ready())
+            {
+                files[in_flight[i].first] = in_flight[i].second.get();
+                in_flight[i] = std::move(in_flight.back());
+                in_flight.pop_back();
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        if (in_flight.size() == before && !in_flight.empty())
+        {
+            (void)in_flight.front().second.wait_for(LOAD_FILES_POLL_INTERVAL);
+        }
+    }
+
+    return files;
+}
+
+auto save_file(std::string_view file_path, const File& file, const FileSaveOptions& options) -> bool
+{
+    return save_file(file_path, get_file_data(file), options);
+}
+
+auto save_file_async(std::string_view file_path, std::span<const std::byte> data, const FileSaveOptions& options)
+    -> std::optional<SaveFuture>
+{
+    std::future<bool> future;
+    try
+    {
+        future = std::async(std::launch::async, [file_path = std::string(file_path), data, options]() -> bool {
+            return save_file(file_path, data, options);
+        });
+    }
+    catch (const std::system_error&)
+    {
+        // No thread could be started for the save
+        return std::nullopt;
+    }
+    return [future = std::move(future)]() mutable -> bool { return future.get(); };
+}
+
+auto allocate_file(uint64_t buffer_size, uint64_t alignment, FileBufferPool* pool) -> File
+{
+    if (pool != nullptr)
+    {
+        return File{
+            .buffer = pool->acquire(buffer_size, alignment),
+            .buffer_size = buffer_size,
+            .bytes_read = 0,
+            .alignment = alignment,
+            .allocation_type = AllocationType::Pooled,
+            .pool = pool,
+        };
+    }
+
+    if (alignment > 1)
+    {
+        return File{
+            .buffer = ::operator new(buffer_size, std::align_val_t(alignment)),
+            .buffer_size = buffer_size,
+            .bytes_read = 0,
+            .alignment = alignment,
+            .allocation_type = AllocationType::Aligned,
+        };
+    }
+
+    return File{
+        .buffer = ::operator new(buffer_size),
+        .buffer_size = buffer_size,
+        .bytes_read = 0,
+        .alignment = 1,
+        .allocation_type = AllocationType::Unaligned,
+    };
+}
+
+auto get_file_data(const File& file) -> std::span<const std::byte>
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return std::span(static_cast<const std::byte*>(file.buffer) + file.data_offset, file.bytes_read);
+}
+
 auto free_file(File& file) -> void
 {
     switch (file.allocation_type)
@@ -17,6 +355,21 @@ auto free_file(File& file) -> void
     case AllocationType::Unaligned:
         ::operator delete(file.buffer);
         break;
+    case AllocationType::Mapped:
+        // Empty files are never actually mapped
+        if (file.buffer == nullptr)
+        {
+            break;
+        }
+#ifdef _WIN32
+        UnmapViewOfFile(file.buffer);
+#else
+        munmap(file.buffer, file.buffer_size);
+#endif
+        break;
+    case AllocationType::Pooled:
+        file.pool->release(file.buffer, file.buffer_size, file.alignment);
+        break;
     default:
         std::unreachable();
     }
@@ -1,13 +1,21 @@
 #ifndef DAEDALUS_IO_FILE_H
 #define DAEDALUS_IO_FILE_H
 
+#include <chrono>
+#include <cstddef>
 #include <functional>
+#include <future>
+#include <memory>
 #include <optional>
+#include <span>
 #include <string_view>
+#include <vector>
 
 namespace dae::io
 {
 
+class FileBufferPool;
+
 /**
  * @brief Enum to encode a strategy to use to load a file.
  */
@@ -31,6 +39,34 @@ enum class FileLoadStrategy : uint8_t
      * DAX (DirectAccess) features.
      */
     SafeDirectDisk,
+    /**
+     * @brief Map the file into the address space read-only instead of copying it into a buffer. Pages are only read
+     * from disk when they are first touched, unless a MappedLoadHint asks for something else.
+     *
+     * @note The buffer of a mapped File is read-only. Writing to it will crash the program. An empty file has nothing
+     * to map, and loads as an empty File with a null buffer.
+     */
+    Mapped,
+};
+
+/**
+ * @brief Enum to guide how the pages of a FileLoadStrategy::Mapped file are brought into memory.
+ */
+enum class MappedLoadHint : uint8_t
+{
+    /**
+     * @brief Pages are faulted in from disk the first time they are touched.
+     */
+    Lazy = 0,
+    /**
+     * @brief Tell the operating system the file will be read front to back and should be read ahead aggressively.
+     * Returns immediately, with readahead continuing in the background.
+     */
+    Sequential,
+    /**
+     * @brief Fault in the whole file before returning, so no page faults to disk happen while the file is in use.
+     */
+    Prefault,
 };
 
 /**
@@ -41,7 +77,97 @@ enum class AllocationType : uint8_t
 {
     Unset = 0,
     Unaligned,
-    Aligned
+    Aligned,
+    Mapped,
+    Pooled
+};
+
+/**
+ * @brief Enum to encode how far a saved file should be flushed towards the disk before a save is considered finished.
+ */
+enum class FileSyncMode : uint8_t
+{
+    /**
+     * @brief Leave the written data in the operating system's cache, to be written back whenever it decides to.
+     */
+    None = 0,
+    /**
+     * @brief Flush the file's data, and only the metadata needed to read it back (`fdatasync`).
+     */
+    Data,
+    /**
+     * @brief Flush the file's data and all of its metadata (`fsync`).
+     */
+    Full,
+};
+
+/**
+ * @brief Settings for saving a file.
+ */
+struct FileSaveOptions
+{
+    /**
+     * @brief The strategy to write the file with. FileLoadStrategy::SafeDirectDisk writes around the filesystem cache.
+     * FileLoadStrategy::Mapped is not supported for saving.
+     */
+    FileLoadStrategy save_strategy{FileLoadStrategy::StdLibrary};
+    /**
+     * @brief Write to a temporary file next to the destination, then rename it over the destination. Readers will
+     * either see the old file or the complete new file, never a partially written one.
+     */
+    bool atomic_replace{false};
+    /**
+     * @brief How far to flush the file before the save is considered finished.
+     */
+    FileSyncMode sync_mode{FileSyncMode::None};
+};
+
+/**
+ * @brief A single file to save as part of a batch with `daedalus::fileio::save_files()`.
+ */
+struct FileSaveRequest
+{
+    std::string_view file_path;
+    std::span<const std::byte> data;
+};
+
+/**
+ * @brief Settings for loading one large file with several concurrent reads.
+ */
+struct FileParallelLoadOptions
+{
+    /**
+     * @brief FileLoadStrategy::SafeDirectDisk reads around the filesystem cache. Every other strategy reads through it.
+     */
+    FileLoadStrategy load_strategy{FileLoadStrategy::SafeDirectDisk};
+    /**
+     * @brief The size of each read. Rounded up to a multiple of the file's alignment, and capped at 1 GiB.
+     */
+    uint64_t range_size{static_cast<uint64_t>(8) * 1024 * 1024};
+    /**
+     * @brief The number of reads to keep in flight at once. On Linux each read is issued from its own thread, and on
+     * Windows each is an overlapped request. Values less than 1 are treated as 1.
+     */
+    uint32_t thread_count{4};
+    /**
+     * @brief If set, the pool to draw the File's buffer from.
+     */
+    FileBufferPool* pool{nullptr};
+};
+
+/**
+ * @brief What a parallel load achieved, for tuning FileParallelLoadOptions on a given machine.
+ */
+struct FileParallelLoadStats
+{
+    uint64_t bytes_read{0};
+    uint64_t range_count{0};
+    uint32_t thread_count{0};
+    /**
+     * @brief Time spent reading, from the first read being issued to the last one completing.
+     */
+    std::chrono::nanoseconds duration{0};
+    double bytes_per_second{0.0};
 };
 
 /**
@@ -51,6 +177,11 @@ struct FileMetaData
 {
     uint64_t size{0};
     uint64_t alignment{0};
+    /**
+     * @brief When the file's contents were last modified, in nanoseconds since the Unix epoch. Only as precise as the
+     * filesystem's timestamps.
+     */
+    int64_t modified_time_ns{0};
 };
 
 /**
@@ -63,12 +194,150 @@ struct File
 {
     void* buffer{nullptr};
     uint64_t buffer_size{0};
+    /**
+     * @brief The number of bytes of file data in the buffer, starting at `data_offset`.
+     */
     uint64_t bytes_read{0};
     uint64_t alignment{0};
     AllocationType allocation_type{};
+    /**
+     * @brief The pool the buffer was drawn from, if the allocation type is AllocationType::Pooled.
+     */
+    FileBufferPool* pool{nullptr};
+    /**
+     * @brief Where the file data starts in the buffer. Always 0 for whole files. A range loaded with
+     * FileLoadStrategy::SafeDirectDisk or FileLoadStrategy::Mapped has its read widened to alignment boundaries, and
+     * the requested range starts this many bytes in.
+     */
+    uint64_t data_offset{0};
+};
+
+/**
+ * @brief A region of a file to load with `daedalus::fileio::load_file_ranges()`.
+ */
+struct FileRange
+{
+    uint64_t offset{0};
+    uint64_t length{0};
+};
+
+/**
+ * @brief A handle to a file that is being loaded asynchronously.
+ *
+ * The load can be polled with `is_ready()` and `bytes_transferred()` without ever blocking, which lets a frame loop
+ * check on loads once per frame. `get()` blocks until the load is complete and hands over the File.
+ *
+ * @note Destroying a FileFuture that still owns a load cancels it and frees its buffer, so a File that is never
+ * retreived with `get()` is not leaked.
+ */
+class FileFuture
+{
+  public:
+    /**
+     * @brief The platform-specific state of a single in-flight load, implemented by each loader.
+     */
+    class State
+    {
+      public:
+        State() = default;
+        virtual ~State() = default;
+
+        State(const State& other) = delete;
+        auto operator=(const State& other) -> State& = delete;
+        State(State&& other) noexcept = delete;
+        auto operator=(State&& other) noexcept -> State& = delete;
+
+        [[nodiscard]] virtual auto is_ready() -> bool = 0;
+        [[nodiscard]] virtual auto wait_for(std::chrono::nanoseconds timeout) -> bool = 0;
+        virtual auto cancel() -> bool = 0;
+        [[nodiscard]] virtual auto bytes_transferred() const -> uint64_t = 0;
+        [[nodiscard]] virtual auto bytes_total() const -> uint64_t = 0;
+        /**
+         * @brief Blocks until the load is complete. Called at most once.
+         */
+        [[nodiscard]] virtual auto get() -> std::optional<File> = 0;
+    };
+
+    FileFuture() = default;
+    explicit FileFuture(std::unique_ptr<State> state);
+    ~FileFuture();
+
+    FileFuture(const FileFuture& other) = delete;
+    auto operator=(const FileFuture& other) -> FileFuture& = delete;
+    FileFuture(FileFuture&& other) noexcept = default;
+    auto operator=(FileFuture&& other) noexcept -> FileFuture&;
+
+    /**
+     * @brief Wraps a std::future running a load on another thread. Such loads cannot be cancelled, and only report
+     * progress once they are complete.
+     */
+    [[nodiscard]] static auto from_future(std::future<std::optional<File>> future) -> FileFuture;
+
+    /**
+     * @brief Wraps the result of a load that has already finished.
+     */
+    [[nodiscard]] static auto from_result(std::optional<File> file) -> FileFuture;
+
+    /**
+     * @brief Whether the future still owns a load, as opposed to being empty, moved from, or already retreived.
+     */
+    [[nodiscard]] auto valid() const -> bool;
+
+    /**
+     * @brief Checks whether the load is complete, without blocking. Once this returns true, `get()` will not block.
+     */
+    [[nodiscard]] auto is_ready() -> bool;
+
+    /**
+     * @brief Blocks until the load is complete or the timeout passes, whichever comes first.
+     *
+     * @param timeout The longest time to block for.
+     *
+     * @return Whether the load is complete.
+     */
+    [[nodiscard]] auto wait_for(std::chrono::nanoseconds timeout) -> bool;
+
+    /**
+     * @brief Asks for the load to be abandoned.
+     *
+     * @note Cancellation races with the load itself, so a load that was just about to finish may still complete.
+     * `get()` returns std::nullopt for a load that was cancelled in time, and the File as usual otherwise.
+     *
+     * @return Whether the request could be made. Loads that are already complete, or that are being run on a thread
+     * that cannot be interrupted, cannot be cancelled.
+     */
+    auto cancel() -> bool;
+
+    /**
+     * @brief The number of bytes read so far. Progress is reported as each underlying read completes, so a load done
+     * with a single read only reports its progress once it is complete.
+     */
+    [[nodiscard]] auto bytes_transferred() const -> uint64_t;
+
+    /**
+     * @brief The number of bytes the load is expected to read, or 0 if it is not known up front.
+     */
+    [[nodiscard]] auto bytes_total() const -> uint64_t;
+
+    /**
+     * @brief Blocks until the load is complete and retreives the File. Afterwards the future is no longer valid.
+     *
+     * @return The File on success, or std::nullopt if the load failed, was cancelled, or the future is not valid.
+     */
+    [[nodiscard]] auto get() -> std::optional<File>;
+
+    /**
+     * @brief Same as `get()`.
+     */
+    [[nodiscard]] auto operator()() -> std::optional<File>;
+
+  private:
+    auto release() -> void;
+
+    std::unique_ptr<State> state;
 };
 
-using FileFuture = std::move_only_function<std::optional<File>()>;
+using SaveFuture = std::move_only_function<bool()>;
 
 /**
  * @brief Attempts to load a file into a buffer.
@@ -87,11 +356,146 @@ using FileFuture = std::move_only_function<std::optional<File>()>;
 [[nodiscard]] auto load_file(std::string_view file_path, FileLoadStrategy load_strategy = FileLoadStrategy::StdLibrary)
     -> std::optional<File>;
 
+/**
+ * @brief Attempts to load a file into a buffer drawn from a FileBufferPool.
+ *
+ * @note FileLoadStrategy::Mapped does not allocate a buffer, and ignores the pool.
+ *
+ * @note The File *must* be freed using `daedalus::fileio::free_file()`, which returns its buffer to the pool. The pool
+ * must outlive the File.
+ *
+ * @param file_path The path to the file.
+ * @param load_strategy Guidance on the strategy to use to load the file.
+ * @param pool The pool to draw the File's buffer from.
+ *
+ * @return File struct on success, or std::nullopt on failure.
+ */
+[[nodiscard]] auto load_file(std::string_view file_path, FileLoadStrategy load_strategy, FileBufferPool& pool)
+    -> std::optional<File>;
+
+/**
+ * @brief Maps a file into the address space read-only, as with FileLoadStrategy::Mapped.
+ *
+ * @note If a `daedalus::fileio::File` is successfully retreived with this function, it *must* be freed using
+ * `daedalus::fileio::free_file()`, which will unmap it.
+ *
+ * @param file_path The path to the file.
+ * @param hint Guidance on whether to fault the file's pages in lazily or eagerly.
+ *
+ * @return File struct whose buffer is the read-only mapping on success, or std::nullopt on failure. An empty file
+ * cannot be mapped, so it gives an empty File with a null buffer, as the other strategies give an empty buffer.
+ */
+[[nodiscard]] auto load_file_mapped(std::string_view file_path, MappedLoadHint hint = MappedLoadHint::Lazy)
+    -> std::optional<File>;
+
+/**
+ * @brief Attempts to load just one region of a file into a buffer.
+ *
+ * @note With FileLoadStrategy::SafeDirectDisk the read is widened out to the file's alignment, and with
+ * FileLoadStrategy::Mapped the mapping is widened out to the page or allocation granularity. The requested region
+ * starts `File::data_offset` bytes into the buffer either way. Use `daedalus::fileio::get_file_data()` to get a view of
+ * just the requested region.
+ *
+ * @note If a `daedalus::fileio::File` is successfully retreived with this function, it *must* be freed using
+ * `daedalus::fileio::free_file()`
+ *
+ * @param file_path The path to the file.
+ * @param offset The offset of the region in the file.
+ * @param length The length of the region. A region that runs past the end of the file is cut short at the end of the
+ * file, so `File::bytes_read` may be less than `length`, and a region that starts at or past the end of the file, or
+ * has a zero length, gives an empty File with every strategy. An empty mapped File has a null buffer.
+ * @param load_strategy Guidance on the strategy to use to load the region.
+ *
+ * @return File struct on success, or std::nullopt on failure.
+ */
+[[nodiscard]] auto load_file_range(std::string_view file_path,
+                                   uint64_t offset,
+                                   uint64_t length,
+                                   FileLoadStrategy load_strategy = FileLoadStrategy::StdLibrary)
+    -> std::optional<File>;
+
+/**
+ * @brief Kicks off an async load of one region of a file, as with `daedalus::fileio::load_file_range()`.
+ *
+ * @param file_path The path to the file.
+ * @param offset The offset of the region in the file.
+ * @param length The length of the region.
+ * @param load_strategy Guidance on the strategy to use to load the region.
+ *
+ * @return A FileFuture for the region, or std::nullopt on failure.
+ */
+[[nodiscard]] auto load_file_range_async(std::string_view file_path,
+                                         uint64_t offset,
+                                         uint64_t length,
+                                         FileLoadStrategy load_strategy = FileLoadStrategy::StdLibrary)
+    -> std::optional<FileFuture>;
+
+/**
+ * @brief Loads several regions of one file, opening the file once and issuing every read at once where the strategy
+ * allows it.
+ *
+ * @note Every `daedalus::fileio::File` that is successfully retreived with this function *must* be freed using
+ * `daedalus::fileio::free_file()`
+ *
+ * @param file_path The path to the file.
+ * @param ranges The regions to load, as with `daedalus::fileio::load_file_range()`.
+ * @param load_strategy Guidance on the strategy to use to load the regions.
+ *
+ * @return A vector with one entry per range, in the same order as `ranges`. If the file cannot be opened every entry
+ * is std::nullopt.
+ */
+[[nodiscard]] auto load_file_ranges(std::string_view file_path,
+                                    std::span<const FileRange> ranges,
+                                    FileLoadStrategy load_strategy = FileLoadStrategy::StdLibrary)
+    -> std::vector<std::optional<File>>;
+
+/**
+ * @brief Loads one file by splitting it into aligned ranges and reading them concurrently into the same buffer.
+ *
+ * @note A single read leaves most of an NVMe drive's queue depth unused. For files of hundreds of megabytes and up,
+ * keeping several reads in flight at once can be several times faster.
+ *
+ * @note If a `daedalus::fileio::File` is successfully retreived with this function, it *must* be freed using
+ * `daedalus::fileio::free_file()`
+ *
+ * @param file_path The path to the file.
+ * @param options The strategy, range size, and number of concurrent reads to use.
+ * @param stats If set, filled in with the bytes read, time taken, and bandwidth achieved.
+ *
+ * @return File struct on success, or std::nullopt on failure. If any range fails to read, the whole load fails.
+ */
+[[nodiscard]] auto load_file_parallel(std::string_view file_path,
+                                      const FileParallelLoadOptions& options = {},
+                                      FileParallelLoadStats* stats = nullptr) -> std::optional<File>;
+
+/**
+ * @brief Loads a file and verifies its CRC32C checksum, as computed by `daedalus::io::crc32c()`.
+ *
+ * @note With FileLoadStrategy::AllowCached and FileLoadStrategy::SafeDirectDisk the file is read in chunks, and each
+ * chunk is checksummed while the next ones are being read, so the data is checksummed while it is still in the CPU's
+ * cache and the checksum mostly hides behind the reads. With FileLoadStrategy::Mapped the checksum is what faults the
+ * pages in. FileLoadStrategy::StdLibrary loads the file first and checksums it afterwards.
+ *
+ * @note If a `daedalus::fileio::File` is successfully retreived with this function, it *must* be freed using
+ * `daedalus::fileio::free_file()`
+ *
+ * @param file_path The path to the file.
+ * @param expected_crc32c The checksum the file should have. If not set, the file is only checksummed, not verified.
+ * @param load_strategy Guidance on the strategy to use to load the file.
+ * @param crc32c If set, filled in with the file's checksum once it is read, even if it does not match.
+ *
+ * @return File struct on success, or std::nullopt if the file could not be loaded or its checksum does not match.
+ */
+[[nodiscard]] auto load_file_checked(std::string_view file_path,
+                                     std::optional<uint32_t> expected_crc32c,
+                                     FileLoadStrategy load_strategy = FileLoadStrategy::AllowCached,
+                                     uint32_t* crc32c = nullptr) -> std::optional<File>;
+
 /**
  * @brief Kicks off an async task to load a file into a local buffer.
  *
- * @note If the file is not done being loaded when the callable is invoked, then the callable will block. This API does
- * not give access to checking on the status of the file read.
+ * @note The returned FileFuture can be polled with `is_ready()` and `bytes_transferred()`, and blocks in `get()` if the
+ * file is not done being loaded yet.
  *
  * @note If a `daedalus::fileio::File` is successfully retreived with this function, it *must* be freed using
  * `daedalus::fileio::free_file()`
@@ -100,13 +504,145 @@ using FileFuture = std::move_only_function<std::optional<File>()>;
  * @param load_strategy Guidance on the strategy to use to load the file. Can have significant impact on file loading
  * speed depending on usage.
  *
- * @return If the file can be loaded asynchronously, will return a callable that when invoked will return the File or
- * block until the File is ready. On any failure, a nullopt will substitute the expected return.
+ * @return If the file can be loaded asynchronously, will return a FileFuture that can be polled for the File, or that
+ * will block until the File is ready. On any failure, a nullopt will substitute the expected return.
  */
 [[nodiscard]] auto load_file_async(std::string_view file_path,
                                    FileLoadStrategy load_strategy = FileLoadStrategy::StdLibrary)
     -> std::optional<FileFuture>;
 
+/**
+ * @brief Kicks off an async task to load a file into a buffer drawn from a FileBufferPool.
+ *
+ * @note The File *must* be freed using `daedalus::fileio::free_file()`, which returns its buffer to the pool. The pool
+ * must outlive both the returned FileFuture and the File.
+ *
+ * @param file_path The path to the file.
+ * @param load_strategy Guidance on the strategy to use to load the file.
+ * @param pool The pool to draw the File's buffer from.
+ *
+ * @return If the file can be loaded asynchronously, will return a FileFuture that can be polled for the File, or that
+ * will block until the File is ready. On any failure, a nullopt will substitute the expected return.
+ */
+[[nodiscard]] auto load_file_async(std::string_view file_path, FileLoadStrategy load_strategy, FileBufferPool& pool)
+    -> std::optional<FileFuture>;
+
+/**
+ * @brief Kicks off async loads of several files at once.
+ *
+ * @note Where the platform allows it, every file is opened first and all of the reads are then handed to the operating
+ * system in a single submission, rather than one at a time.
+ *
+ * @note Every `daedalus::fileio::File` that is successfully retreived with this function *must* be freed using
+ * `daedalus::fileio::free_file()`
+ *
+ * @param file_paths The paths to the files.
+ * @param load_strategy Guidance on the strategy to use to load the files.
+ *
+ * @return A vector with one entry per path, in the same order as `file_paths`. A file that could not be opened has a
+ * std::nullopt entry.
+ */
+[[nodiscard]] auto load_files_async(std::span<const std::string_view> file_paths,
+                                    FileLoadStrategy load_strategy = FileLoadStrategy::StdLibrary)
+    -> std::vector<std::optional<FileFuture>>;
+
+/**
+ * @brief Loads a batch of files, keeping up to `queue_depth` loads in flight at once.
+ *
+ * @note Keeping several reads in flight lets the operating system overlap and reorder them, which is much faster than
+ * loading the files one at a time when there are many of them. The next files are opened with `load_files_async()` on
+ * a worker thread while the loads in flight finish, and each load is collected as soon as it is ready, so a slow file
+ * does not hold up the rest.
+ *
+ * @note Every `daedalus::fileio::File` that is successfully retreived with this function *must* be freed using
+ * `daedalus::fileio::free_file()`
+ *
+ * @param file_paths The paths to the files.
+ * @param load_strategy Guidance on the strategy to use to load the files.
+ * @param queue_depth The most loads to have in flight at once. Values less than 1 are treated as 1.
+ *
+ * @return A vector with one entry per path, in the same order as `file_paths`. A file that fails to load has a
+ * std::nullopt entry, and does not stop the rest of the batch from loading.
+ */
+[[nodiscard]] auto load_files(std::span<const std::string_view> file_paths,
+                              FileLoadStrategy load_strategy = FileLoadStrategy::StdLibrary,
+                              size_t queue_depth = 32) -> std::vector<std::optional<File>>;
+
+/**
+ * @brief Writes a buffer to a file, replacing the file if it exists.
+ *
+ * @note With FileLoadStrategy::SafeDirectDisk, a buffer aligned to the destination's alignment is written directly
+ * without being copied. Unaligned buffers are copied through an aligned staging buffer.
+ *
+ * @param file_path The path to the file.
+ * @param data The bytes to write.
+ * @param options Settings for the write strategy, atomic replacement and syncing.
+ *
+ * @return True if the whole buffer was written (and synced, if requested), false otherwise.
+ */
+[[nodiscard]] auto save_file(std::string_view file_path,
+                             std::span<const std::byte> data,
+                             const FileSaveOptions& options = {}) -> bool;
+
+/**
+ * @brief Writes the contents of a loaded File to a file, replacing the file if it exists.
+ *
+ * @note A File loaded with AllocationType::Aligned can be written with FileLoadStrategy::SafeDirectDisk without any
+ * copies.
+ *
+ * @param file_path The path to the file.
+ * @param file The File whose read bytes should be written.
+ * @param options Settings for the write strategy, atomic replacement and syncing.
+ *
+ * @return True if the whole File was written (and synced, if requested), false otherwise.
+ */
+[[nodiscard]] auto save_file(std::string_view file_path, const File& file, const FileSaveOptions& options = {}) -> bool;
+
+/**
+ * @brief Kicks off an async task to write a buffer to a file.
+ *
+ * @note The buffer must be kept alive until the returned callable has been invoked.
+ *
+ * @param file_path The path to the file.
+ * @param data The bytes to write.
+ * @param options Settings for the write strategy, atomic replacement and syncing.
+ *
+ * @return A callable that when invoked blocks until the save is finished and returns whether it succeeded, or
+ * std::nullopt if no thread could be started for the save.
+ */
+[[nodiscard]] auto save_file_async(std::string_view file_path,
+                                   std::span<const std::byte> data,
+                                   const FileSaveOptions& options = {}) -> std::optional<SaveFuture>;
+
+/**
+ * @brief Saves a batch of files. Every file is written before any of them are synced, so the writeback of the whole
+ * batch can overlap instead of paying for one flush at a time.
+ *
+ * @param requests The files to save.
+ * @param options Settings shared by every file in the batch.
+ *
+ * @return One entry per request, in the same order, with whether that file was saved. A failure does not stop the rest
+ * of the batch from being saved.
+ */
+[[nodiscard]] auto save_files(std::span<const FileSaveRequest> requests, const FileSaveOptions& options = {})
+    -> std::vector<bool>;
+
+/**
+ * @brief Allocates an empty File with a buffer of the given size and alignment, in the same way the loaders do.
+ *
+ * @param buffer_size The size of the buffer.
+ * @param alignment The alignment of the buffer. An alignment of 1 allocates with AllocationType::Unaligned.
+ * @param pool If set, the buffer is drawn from this pool and the File uses AllocationType::Pooled.
+ *
+ * @return The File. It *must* be freed using `daedalus::fileio::free_file()`.
+ */
+[[nodiscard]] auto allocate_file(uint64_t buffer_size, uint64_t alignment, FileBufferPool* pool = nullptr) -> File;
+
+/**
+ * @brief Gets a view of a File's data, skipping over any alignment padding before `File::data_offset`.
+ */
+[[nodiscard]] auto get_file_data(const File& file) -> std::span<const std::byte>;
+
 /**
  * @brief Frees a file.
  *
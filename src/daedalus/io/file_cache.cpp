@@ -0,0 +1,184 @@
+#include "daedalus/io/file_cache.h"
+
+#include <utility>
+
+namespace dae::io
+{
+
+namespace
+{
+/**
+ * @brief Whether a file has changed on disk since it was loaded.
+ */
+auto is_stale(const FileMetaData& cached, const FileMetaData& current) -> bool
+{
+    return cached.size != current.size || cached.modified_time_ns != current.modified_time_ns;
+}
+} // namespace
+
+CachedFile::CachedFile(File file, FileMetaData meta_data) : file(file), meta(meta_data)
+{
+}
+
+CachedFile::~CachedFile()
+{
+    free_file(file);
+}
+
+auto CachedFile::data() const -> std::span<const std::byte>
+{
+    return get_file_data(file);
+}
+
+auto CachedFile::meta_data() const -> const FileMetaData&
+{
+    return meta;
+}
+
+FileCache::FileCache(uint64_t max_bytes_held, FileLoadStrategy load_strategy)
+    : max_bytes_held(max_bytes_held), load_strategy(load_strategy)
+{
+}
+
+auto FileCache::get(std::string_view file_path) -> std::optional<std::shared_ptr<const CachedFile>>
+{
+    // Checked outside the lock, as it costs a system call
+    std::optional<FileMetaData> meta_data = get_file_meta_data(file_path);
+    std::string path(file_path);
+
+    std::unique_lock lock(mutex);
+    auto it = entries.find(path);
+    if (!meta_data)
+    {
+        if (it != entries.end() && it->second.file != nullptr)
+        {
+            counters.invalidations++;
+            erase_locked(it);
+        }
+        return std::nullopt;
+    }
+
+    if (it != entries.end())
+    {
+        Entry& entry = it->second;
+
+        // Another thread is already loading the file, so wait for its result instead of loading it again
+        if (entry.file == nullptr)
+        {
+            counters.hits++;
+            std::shared_future<std::shared_ptr<const CachedFile>> load = entry.load;
+            lock.unlock();
+            std::shared_ptr<const CachedFile> file = load.get();
+            if (file == nullptr)
+            {
+                return std::nullopt;
+            }
+            return file;
+        }
+
+        if (!is_stale(entry.file->meta_data(), meta_data.value()))
+        {
+            counters.hits++;
+            lru.splice(lru.begin(), lru, entry.lru_position);
+            return entry.file;
+        }
+
+        counters.invalidations++;
+        erase_locked(it);
+    }
+
+    counters.misses++;
+    std::promise<std::shared_ptr<const CachedFile>> promise;
+    const uint64_t load_id = next_load_id++;
+    entries.emplace(path,
+                    Entry{
+                        .load = promise.get_future().share(),
+                        .load_id = load_id,
+                        .file = nullptr,
+                        .lru_position = lru.end(),
+                    });
+    lock.unlock();
+
+    std::shared_ptr<const CachedFile> file;
+    std::optional<File> loaded = load_file(file_path, load_strategy);
+    if (loaded)
+    {
+        file = std::make_shared<const CachedFile>(loaded.value(), meta_data.value());
+    }
+    promise.set_value(file);
+
+    lock.lock();
+
+    // The entry may have been invalidated or cleared while the file was loading, in which case it is no longer ours
+    it = entries.find(path);
+    if (it != entries.end() && it->second.load_id == load_id)
+    {
+        if (file == nullptr || file->data().size() > max_bytes_held)
+        {
+            entries.erase(it);
+        }
+        else
+        {
+            it->second.file = file;
+            lru.push_front(path);
+            it->second.lru_position = lru.begin();
+            counters.bytes_held += file->data().size();
+            counters.files_held++;
+            evict_locked();
+        }
+    }
+
+    if (file == nullptr)
+    {
+        return std::nullopt;
+    }
+    return file;
+}
+
+auto FileCache::invalidate(std::string_view file_path) -> void
+{
+    std::lock_guard lock(mutex);
+    auto it = entries.find(std::string(file_path));
+    if (it != entries.end())
+    {
+        erase_locked(it);
+    }
+}
+
+auto FileCache::clear() -> void
+{
+    std::lock_guard lock(mutex);
+    entries.clear();
+    lru.clear();
+    counters.bytes_held = 0;
+    counters.files_held = 0;
+}
+
+auto FileCache::stats() const -> FileCacheStats
+{
+    std::lock_guard lock(mutex);
+    return counters;
+}
+
+auto FileCache::erase_locked(std::unordered_map<std::string, Entry>::iterator it) -> void
+{
+    // Entries that are still loading have nothing held yet
+    if (it->second.file != nullptr)
+    {
+        lru.erase(it->second.lru_position);
+        counters.bytes_held -= it->second.file->data().size();
+        counters.files_held--;
+    }
+    entries.erase(it);
+}
+
+auto FileCache::evict_locked() -> void
+{
+    while (counters.bytes_held > max_bytes_held && !lru.empty())
+    {
+        counters.evictions++;
+        erase_locked(entries.find(lru.back()));
+    }
+}
+
+} // namespace dae::io
@@ -0,0 +1,160 @@
+#ifndef DAEDALUS_IO_FILE_CACHE_H
+#define DAEDALUS_IO_FILE_CACHE_H
+
+#include "daedalus/io/file.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace dae::io
+{
+
+/**
+ * @brief A file held by a FileCache. The file is freed once it has left the cache and the last handle to it is gone.
+ */
+class CachedFile
+{
+  public:
+    CachedFile(File file, FileMetaData meta_data);
+    ~CachedFile();
+
+    CachedFile(const CachedFile& other) = delete;
+    auto operator=(const CachedFile& other) -> CachedFile& = delete;
+    CachedFile(CachedFile&& other) noexcept = delete;
+    auto operator=(CachedFile&& other) noexcept -> CachedFile& = delete;
+
+    /**
+     * @brief Gets a view of the file's data.
+     */
+    [[nodiscard]] auto data() const -> std::span<const std::byte>;
+
+    /**
+     * @brief The metadata the file was validated against when it was loaded.
+     */
+    [[nodiscard]] auto meta_data() const -> const FileMetaData&;
+
+  private:
+    File file;
+    FileMetaData meta;
+};
+
+/**
+ * @brief Counters describing how well a FileCache is being used, for sizing its byte budget.
+ */
+struct FileCacheStats
+{
+    /**
+     * @brief Lookups answered from the cache, including lookups that waited on another thread's load of the same file.
+     */
+    uint64_t hits{0};
+    uint64_t misses{0};
+    /**
+     * @brief Files dropped to stay under the byte budget.
+     */
+    uint64_t evictions{0};
+    /**
+     * @brief Files dropped because they changed on disk.
+     */
+    uint64_t invalidations{0};
+    uint64_t bytes_held{0};
+    uint64_t files_held{0};
+};
+
+/**
+ * @brief A thread-safe cache of loaded files, so that parts of a program loading the same file share one copy of it.
+ *
+ * Every lookup checks the file's size and modification time with `daedalus::fileio::get_file_meta_data()`, and reloads
+ * the file if either has changed. Concurrent lookups of a file that is not cached yet share a single load instead of
+ * each loading it. When the files held go over the byte budget, the least recently used files are dropped.
+ *
+ * @note Files are keyed by the path string they are looked up with, so two different spellings of the same path are
+ * cached separately.
+ */
+class FileCache
+{
+  public:
+    /**
+     * @param max_bytes_held The most bytes of file data the cache will hold on to. Files bigger than this are loaded
+     * but never held.
+     * @param load_strategy The strategy to load files with.
+     */
+    explicit FileCache(uint64_t max_bytes_held = static_cast<uint64_t>(256) * 1024 * 1024,
+                       FileLoadStrategy load_strategy = FileLoadStrategy::AllowCached);
+
+    FileCache(const FileCache& other) = delete;
+    auto operator=(const FileCache& other) -> FileCache& = delete;
+    FileCache(FileCache&& other) noexcept = delete;
+    auto operator=(FileCache&& other) noexcept -> FileCache& = delete;
+
+    /**
+     * @brief Gets a file from the cache, loading it if it is not cached or has changed on disk.
+     *
+     * @param file_path The path to the file.
+     *
+     * @return A shared handle to the file, which stays valid even after the file leaves the cache, or std::nullopt if
+     * the file could not be loaded.
+     */
+    [[nodiscard]] auto get(std::string_view file_path) -> std::optional<std::shared_ptr<const CachedFile>>;
+
+    /**
+     * @brief Drops a file from the cache. Handles to it stay valid.
+     */
+    auto invalidate(std::string_view file_path) -> void;
+
+    /**
+     * @brief Drops every file from the cache. Handles to them stay valid.
+     */
+    auto clear() -> void;
+
+    /**
+     * @brief Gets the cache's counters.
+     */
+    [[nodiscard]] auto stats() const -> FileCacheStats;
+
+  private:
+    struct Entry
+    {
+        /**
+         * @brief Set by whichever lookup loads the file, and waited on by any others that arrive while it is loading.
+         */
+        std::shared_future<std::shared_ptr<const CachedFile>> load;
+        /**
+         * @brief Tells loads apart, so a load finishing after its entry was invalidated does not touch the entry that
+         * replaced it.
+         */
+        uint64_t load_id{0};
+        std::shared_ptr<const CachedFile> file;
+        /**
+         * @brief The entry's place in `lru`, once it has finished loading.
+         */
+        std::list<std::string>::iterator lru_position;
+    };
+
+    auto erase_locked(std::unordered_map<std::string, Entry>::iterator it) -> void;
+    auto evict_locked() -> void;
+
+    const uint64_t max_bytes_held;
+    const FileLoadStrategy load_strategy;
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+    /**
+     * @brief Paths of the loaded files, from most to least recently used.
+     */
+    std::list<std::string> lru;
+    FileCacheStats counters{};
+    uint64_t next_load_id{0};
+};
+
+} // namespace dae::io
+
+#endif
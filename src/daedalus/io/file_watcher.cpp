@@ -0,0 +1,299 @@
+#include "daedalus/io/file_watcher.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <utility>
+
+namespace dae::io
+{
+
+namespace
+{
+/**
+ * @brief Normalizes a directory path, so that one directory reached through different watches shares one watch.
+ */
+auto normalize_directory(const std::filesystem::path& directory) -> std::string
+{
+    std::string normalized = directory.lexically_normal().generic_string();
+    if (normalized.size() > 1 && normalized.back() == '/')
+    {
+        normalized.pop_back();
+    }
+    return normalized.empty() ? "." : normalized;
+}
+
+/**
+ * @brief Folds a new event for a file into the change already pending for it.
+ *
+ * @return The combined change, or std::nullopt if the events cancel out.
+ */
+auto coalesce(FileChangeType pending, FileChangeType event) -> std::optional<FileChangeType>
+{
+    if (pending == FileChangeType::Created && event == FileChangeType::Removed)
+    {
+        // A file that came and went between polls was never there as far as the caller is concerned
+        return std::nullopt;
+    }
+    if (pending == FileChangeType::Removed && event == FileChangeType::Created)
+    {
+        return FileChangeType::Modified;
+    }
+    if (pending == FileChangeType::Created && event == FileChangeType::Modified)
+    {
+        return FileChangeType::Created;
+    }
+    return event;
+}
+} // namespace
+
+FileWatcher::~FileWatcher()
+{
+    release();
+}
+
+FileWatcher::FileWatcher(FileWatcher&& other) noexcept
+    : handle(std::exchange(other.handle, -1)), coalesce_window(other.coalesce_window),
+      watches(std::move(other.watches)), pending(std::move(other.pending))
+{
+}
+
+auto FileWatcher::operator=(FileWatcher&& other) noexcept -> FileWatcher&
+{
+    if (this != &other)
+    {
+        release();
+        handle = std::exchange(other.handle, -1);
+        coalesce_window = other.coalesce_window;
+        watches = std::move(other.watches);
+        pending = std::move(other.pending);
+    }
+    return *this;
+}
+
+auto FileWatcher::create(const FileWatcherOptions& options) -> std::optional<FileWatcher>
+{
+    std::optional<intptr_t> native = open_native();
+    if (!native)
+    {
+        return std::nullopt;
+    }
+
+    FileWatcher watcher;
+    watcher.handle = native.value();
+    watcher.coalesce_window = options.coalesce_window;
+    return watcher;
+}
+
+auto FileWatcher::watch_file(std::string_view file_path) -> bool
+{
+    const std::filesystem::path path(file_path);
+    std::string name = path.filename().string();
+    if (name.empty())
+    {
+        return false;
+    }
+
+    Watch* watch = get_watch(normalize_directory(path.parent_path()));
+    if (watch == nullptr)
+    {
+        return false;
+    }
+
+    watch->files.emplace(std::move(name), std::string(file_path));
+    return true;
+}
+
+auto FileWatcher::watch_directory(std::string_view directory_path) -> bool
+{
+    Watch* watch = get_watch(normalize_directory(directory_path));
+    if (watch == nullptr)
+    {
+        return false;
+    }
+
+    watch->whole_directory = true;
+    return true;
+}
+
+auto FileWatcher::unwatch(std::string_view path) -> void
+{
+    const std::string directory = normalize_directory(path);
+    pending.erase(std::string(path));
+
+    for (auto it = watches.begin(); it != watches.end(); ++it)
+    {
+        Watch& watch = **it;
+        if (watch.directory == directory && watch.whole_directory)
+        {
+            // Drop changes that were only being reported because of the directory watch
+            watch.whole_directory = false;
+            const std::string prefix = directory + '/';
+            auto is_watched_file = [&](const std::string& changed_path) -> bool {
+                return std::ranges::any_of(watch.files,
+                                           [&](const auto& file) -> bool { return file.second == changed_path; });
+            };
+            std::erase_if(pending, [&](const auto& change) -> bool {
+                return change.first.starts_with(prefix) && !is_watched_file(change.first);
+            });
+        }
+        std::erase_if(watch.files, [&](const auto& file) -> bool { return file.second == path; });
+
+        if (!watch.whole_directory && watch.files.empty())
+        {
+            remove_native_watch(watch);
+            watches.erase(it);
+            return;
+        }
+    }
+}
+
+auto FileWatcher::poll() -> std::vector<FileChange>
+{
+    read_native_events();
+    return take_settled_changes();
+}
+
+auto FileWatcher::wait(std::chrono::milliseconds timeout) -> std::vector<FileChange>
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (true)
+    {
+        read_native_events();
+        std::vector<FileChange> changes = take_settled_changes();
+        if (!changes.empty())
+        {
+            return changes;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+        {
+            return changes;
+        }
+
+        // Wake up for whichever comes first: the timeout, or the next pending change settling
+        auto wake = deadline;
+        for (const auto& [path, change] : pending)
+        {
+            wake = std::min(wake, change.last_event + coalesce_window);
+        }
+        wait_native(std::chrono::ceil<std::chrono::milliseconds>(wake - now));
+    }
+}
+
+auto FileWatcher::poll_reload(FileLoadStrategy load_strategy) -> std::vector<FileReload>
+{
+    std::vector<FileChange> changes = poll();
+
+    std::vector<FileReload> reloads;
+    reloads.reserve(changes.size());
+    for (FileChange& change : changes)
+    {
+        FileReload& reload = reloads.emplace_back(FileReload{.change = std::move(change), .load = std::nullopt});
+        if (reload.change.type != FileChangeType::Removed)
+        {
+            reload.load = load_file_async(reload.change.path, load_strategy);
+        }
+    }
+    return reloads;
+}
+
+auto FileWatcher::get_watch(const std::string& directory) -> Watch*
+{
+    auto it = std::ranges::find(watches, directory, [](const std::unique_ptr<Watch>& watch) -> const std::string& {
+        return watch->directory;
+    });
+    if (it != watches.end())
+    {
+        return it->get();
+    }
+
+    std::unique_ptr<Watch> watch = std::make_unique<Watch>();
+    watch->directory = directory;
+    if (!add_native_watch(*watch))
+    {
+        return nullptr;
+    }
+
+    return watches.emplace_back(std::move(watch)).get();
+}
+
+auto FileWatcher::on_event(const Watch& watch, std::string_view name, FileChangeType type) -> void
+{
+    std::string path;
+    auto file = watch.files.find(std::string(name));
+    if (file != watch.files.end())
+    {
+        path = file->second;
+    }
+    else if (watch.whole_directory)
+    {
+        path = watch.directory + '/' + std::string(name);
+    }
+    else
+    {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    auto [it, inserted] = pending.try_emplace(std::move(path), PendingChange{.type = type, .last_event = now});
+    if (inserted)
+    {
+        return;
+    }
+
+    std::optional<FileChangeType> coalesced = coalesce(it->second.type, type);
+    if (!coalesced)
+    {
+        pending.erase(it);
+        return;
+    }
+    it->second.type = coalesced.value();
+    it->second.last_event = now;
+}
+
+auto FileWatcher::on_overflow() -> void
+{
+    for (const std::unique_ptr<Watch>& watch : watches)
+    {
+        for (const auto& [name, path] : watch->files)
+        {
+            on_event(*watch, name, FileChangeType::Modified);
+        }
+    }
+}
+
+auto FileWatcher::take_settled_changes() -> std::vector<FileChange>
+{
+    std::vector<FileChange> changes;
+    const auto now = std::chrono::steady_clock::now();
+    for (auto it = pending.begin(); it != pending.end();)
+    {
+        if (now - it->second.last_event < coalesce_window)
+        {
+            ++it;
+            continue;
+        }
+        changes.push_back(FileChange{.path = it->first, .type = it->second.type});
+        it = pending.erase(it);
+    }
+    return changes;
+}
+
+auto FileWatcher::release() -> void
+{
+    for (const std::unique_ptr<Watch>& watch : watches)
+    {
+        remove_native_watch(*watch);
+    }
+    watches.clear();
+    pending.clear();
+
+    if (handle != -1)
+    {
+        close_native();
+        handle = -1;
+    }
+}
+
+} // namespace dae::io
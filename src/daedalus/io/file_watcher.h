@@ -0,0 +1,197 @@
+#ifndef DAEDALUS_IO_FILE_WATCHER_H
+#define DAEDALUS_IO_FILE_WATCHER_H
+
+#include "daedalus/io/file.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace dae::io
+{
+
+/**
+ * @brief What happened to a watched file.
+ */
+enum class FileChangeType : uint8_t
+{
+    Modified = 0,
+    Created,
+    /**
+     * @brief The file was deleted, or renamed away. A file renamed over a watched file is reported as Modified.
+     */
+    Removed,
+};
+
+/**
+ * @brief A change to a watched file, after coalescing.
+ */
+struct FileChange
+{
+    /**
+     * @brief The path as it was passed to `FileWatcher::watch_file()`, or the watched directory joined with the file's
+     * name for changes found through `FileWatcher::watch_directory()`.
+     */
+    std::string path;
+    FileChangeType type{FileChangeType::Modified};
+};
+
+/**
+ * @brief A change to a watched file, along with the reload that was started for it.
+ */
+struct FileReload
+{
+    FileChange change;
+    /**
+     * @brief The reload, from `daedalus::fileio::load_file_async()`. Not set for removed files, or if the reload could
+     * not be started.
+     */
+    std::optional<FileFuture> load;
+};
+
+struct FileWatcherOptions
+{
+    /**
+     * @brief How long a file has to go without any new events before its change is delivered, counted from when the
+     * watcher reads the events. Saving a file tends to raise a burst of events (create, write, close, rename), which
+     * this folds into one change.
+     */
+    std::chrono::milliseconds coalesce_window{50};
+};
+
+/**
+ * @brief Watches files and directories for changes, using inotify on Linux and `ReadDirectoryChangesW` on Windows.
+ *
+ * Watching is done per directory, so files that are replaced by renaming a new file over them (as many editors save)
+ * keep being watched. Events are read without blocking and coalesced per file, so polling every frame costs a single
+ * system call when nothing has changed.
+ *
+ * @note Directories are not watched recursively. The watcher is not thread-safe, and is meant to be polled from one
+ * thread.
+ */
+class FileWatcher
+{
+  public:
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher& other) = delete;
+    auto operator=(const FileWatcher& other) -> FileWatcher& = delete;
+    FileWatcher(FileWatcher&& other) noexcept;
+    auto operator=(FileWatcher&& other) noexcept -> FileWatcher&;
+
+    /**
+     * @brief Creates a watcher with nothing watched yet.
+     *
+     * @return A FileWatcher, or std::nullopt if the operating system's watch API could not be set up.
+     */
+    [[nodiscard]] static auto create(const FileWatcherOptions& options = {}) -> std::optional<FileWatcher>;
+
+    /**
+     * @brief Starts watching a single file. The file does not have to exist yet, but the directory it is in does.
+     *
+     * @return True if the file is being watched.
+     */
+    auto watch_file(std::string_view file_path) -> bool;
+
+    /**
+     * @brief Starts watching every file directly inside a directory.
+     *
+     * @return True if the directory is being watched.
+     */
+    auto watch_directory(std::string_view directory_path) -> bool;
+
+    /**
+     * @brief Stops watching a file or directory, as passed to `watch_file()` or `watch_directory()`.
+     */
+    auto unwatch(std::string_view path) -> void;
+
+    /**
+     * @brief Gets the changes that have settled since the last call, without blocking.
+     *
+     * @return The changes, one per file. Empty if nothing has changed.
+     */
+    [[nodiscard]] auto poll() -> std::vector<FileChange>;
+
+    /**
+     * @brief Waits until at least one change has settled, or the timeout runs out.
+     *
+     * @return The changes, one per file. Empty if the timeout ran out first.
+     */
+    [[nodiscard]] auto wait(std::chrono::milliseconds timeout) -> std::vector<FileChange>;
+
+    /**
+     * @brief Polls for changes, and starts an async load of every file that was created or modified.
+     *
+     * @param load_strategy The strategy to reload files with.
+     *
+     * @return The changes along with their reloads.
+     */
+    [[nodiscard]] auto poll_reload(FileLoadStrategy load_strategy = FileLoadStrategy::AllowCached)
+        -> std::vector<FileReload>;
+
+  private:
+    /**
+     * @brief One watched directory, and the files in it that are being watched.
+     */
+    struct Watch
+    {
+        std::string directory;
+        bool whole_directory{false};
+        /**
+         * @brief Watched file names, mapped to the path they were watched with.
+         */
+        std::unordered_map<std::string, std::string> files;
+        intptr_t handle{-1};
+        std::shared_ptr<void> native_state;
+    };
+
+    struct PendingChange
+    {
+        FileChangeType type{FileChangeType::Modified};
+        std::chrono::steady_clock::time_point last_event;
+    };
+
+    FileWatcher() = default;
+
+    // Implemented per platform
+    static auto open_native() -> std::optional<intptr_t>;
+    auto close_native() -> void;
+    auto add_native_watch(Watch& watch) -> bool;
+    auto remove_native_watch(Watch& watch) -> void;
+    /**
+     * @brief Reads every queued event without blocking, passing each one to `on_event()`.
+     */
+    auto read_native_events() -> void;
+    /**
+     * @brief Blocks until an event is queued or the timeout runs out.
+     */
+    auto wait_native(std::chrono::milliseconds timeout) -> void;
+
+    /**
+     * @brief Gets the watch for a directory, adding one if the directory is not watched yet.
+     *
+     * @return The watch, or nullptr if the directory could not be watched.
+     */
+    auto get_watch(const std::string& directory) -> Watch*;
+    auto on_event(const Watch& watch, std::string_view name, FileChangeType type) -> void;
+    /**
+     * @brief Reports every watched file as modified, after the operating system dropped events it could not queue.
+     */
+    auto on_overflow() -> void;
+    auto take_settled_changes() -> std::vector<FileChange>;
+    auto release() -> void;
+
+    intptr_t handle{-1};
+    std::chrono::milliseconds coalesce_window{0};
+    std::vector<std::unique_ptr<Watch>> watches;
+    std::unordered_map<std::string, PendingChange> pending;
+};
+
+} // namespace dae::io
+
+#endif
@@ -0,0 +1,204 @@
+#include "daedalus/io/stream.h"
+
+#include "daedalus/math/math.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace dae::io
+{
+
+FileStreamReader::~FileStreamReader()
+{
+    release();
+}
+
+FileStreamReader::FileStreamReader(FileStreamReader&& other) noexcept
+    : native(std::exchange(other.native, {})), delimiter(other.delimiter), chunk_size(other.chunk_size),
+      headroom(other.headroom), buffer_alignment(other.buffer_alignment),
+      buffers{std::exchange(other.buffers[0], nullptr), std::exchange(other.buffers[1], nullptr)},
+      read_buffer(other.read_buffer), next_offset(other.next_offset),
+      read_pending(std::exchange(other.read_pending, false)), error(other.error),
+      carry(std::exchange(other.carry, nullptr)), carry_size(std::exchange(other.carry_size, 0))
+{
+}
+
+auto FileStreamReader::operator=(FileStreamReader&& other) noexcept -> FileStreamReader&
+{
+    if (this != &other)
+    {
+        release();
+        native = std::exchange(other.native, {});
+        delimiter = other.delimiter;
+        chunk_size = other.chunk_size;
+        headroom = other.headroom;
+        buffer_alignment = other.buffer_alignment;
+        buffers[0] = std::exchange(other.buffers[0], nullptr);
+        buffers[1] = std::exchange(other.buffers[1], nullptr);
+        read_buffer = other.read_buffer;
+        next_offset = other.next_offset;
+        read_pending = std::exchange(other.read_pending, false);
+        error = other.error;
+        carry = std::exchange(other.carry, nullptr);
+        carry_size = std::exchange(other.carry_size, 0);
+    }
+    return *this;
+}
+
+auto FileStreamReader::open(std::string_view file_path, const FileStreamOptions& options)
+    -> std::optional<FileStreamReader>
+{
+    const bool direct = options.load_strategy == FileLoadStrategy::SafeDirectDisk;
+
+    std::optional<NativeFile> native_file = open_native(file_path, direct);
+    if (!native_file)
+    {
+        return std::nullopt;
+    }
+
+    FileStreamReader reader;
+    reader.native = std::move(native_file.value());
+    reader.delimiter = options.delimiter;
+    reader.buffer_alignment = std::max<uint64_t>(reader.native.alignment, alignof(std::max_align_t));
+    reader.chunk_size = dae::align_up(std::max<uint64_t>(options.chunk_size, 1), reader.native.alignment);
+
+    // Carried over bytes are copied in front of the next chunk, and are always shorter than a chunk
+    reader.headroom = reader.delimiter ? reader.chunk_size : 0;
+
+    for (char*& buffer : reader.buffers)
+    {
+        buffer = static_cast<char*>(
+            ::operator new(reader.headroom + reader.chunk_size, std::align_val_t(reader.buffer_alignment)));
+    }
+
+    reader.start_next_read();
+
+    return reader;
+}
+
+auto FileStreamReader::next() -> std::optional<std::string_view>
+{
+    if (!read_pending)
+    {
+        return std::nullopt;
+    }
+
+    std::optional<uint64_t> bytes_read = finish_read(native);
+    read_pending = false;
+    if (!bytes_read)
+    {
+        error = true;
+        return std::nullopt;
+    }
+
+    char* data = buffers[read_buffer] + headroom; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    uint64_t size = bytes_read.value();
+    const uint64_t read_offset = next_offset;
+    next_offset += size;
+    const bool at_end = size < chunk_size || next_offset >= native.size;
+
+    // The carried over bytes live in the other buffer, so they have to be moved before it is read into again
+    if (carry_size > 0)
+    {
+        data -= carry_size;                  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memmove(data, carry, carry_size);
+        size += carry_size;
+        carry = nullptr;
+        carry_size = 0;
+    }
+
+    if (size == 0 && read_offset >= native.size)
+    {
+        return std::nullopt;
+    }
+
+    read_buffer ^= 1;
+    if (!at_end)
+    {
+        start_next_read();
+    }
+
+    if (delimiter && !at_end)
+    {
+        std::string_view chunk(data, size);
+        size_t last = chunk.rfind(delimiter.value());
+        if (last != std::string_view::npos)
+        {
+            carry = data + last + 1; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            carry_size = size - (last + 1);
+            size = last + 1;
+        }
+    }
+
+    return std::string_view(data, size);
+}
+
+auto FileStreamReader::file_size() const -> uint64_t
+{
+    return native.size;
+}
+
+auto FileStreamReader::has_error() const -> bool
+{
+    return error;
+}
+
+auto FileStreamReader::start_next_read() -> void
+{
+    char* target = buffers[read_buffer] + headroom; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    read_pending = start_read(native, target, chunk_size, next_offset);
+    if (!read_pending)
+    {
+        error = true;
+    }
+}
+
+auto FileStreamReader::release() -> void
+{
+    // The in-flight read has to land before its buffer can be freed
+    if (read_pending)
+    {
+        (void)finish_read(native);
+        read_pending = false;
+    }
+
+    if (native.handle != -1)
+    {
+        close_native(native);
+        native.handle = -1;
+    }
+
+    for (char*& buffer : buffers)
+    {
+        if (buffer != nullptr)
+        {
+            ::operator delete(buffer, std::align_val_t(buffer_alignment));
+            buffer = nullptr;
+        }
+    }
+}
+
+auto for_each_chunk(std::string_view file_path,
+                    const FileStreamOptions& options,
+                    const std::function<bool(std::string_view)>& callback) -> bool
+{
+    std::optional<FileStreamReader> reader = FileStreamReader::open(file_path, options);
+    if (!reader)
+    {
+        return false;
+    }
+
+    while (std::optional<std::string_view> chunk = reader->next())
+    {
+        if (!callback(chunk.value()))
+        {
+            break;
+        }
+    }
+
+    return !reader->has_error();
+}
+
+} // namespace dae::io
@@ -0,0 +1,136 @@
+#ifndef DAEDALUS_IO_STREAM_H
+#define DAEDALUS_IO_STREAM_H
+
+#include "daedalus/io/file.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+namespace dae::io
+{
+
+/**
+ * @brief Settings for streaming a file in chunks with a FileStreamReader.
+ */
+struct FileStreamOptions
+{
+    /**
+     * @brief The number of bytes to read from the file at a time. With FileLoadStrategy::SafeDirectDisk this is rounded
+     * up to a multiple of the file's alignment.
+     */
+    uint64_t chunk_size{static_cast<uint64_t>(4) * 1024 * 1024};
+    /**
+     * @brief FileLoadStrategy::SafeDirectDisk bypasses the filesystem cache. Every other strategy reads through it.
+     */
+    FileLoadStrategy load_strategy{FileLoadStrategy::AllowCached};
+    /**
+     * @brief If set, every chunk except the last is cut short after the last delimiter in it, and the remainder is
+     * carried over to the front of the next chunk. This keeps lines from being split across chunks.
+     *
+     * @note If a chunk holds no delimiter at all, it is returned whole along with any carried over bytes.
+     */
+    std::optional<char> delimiter;
+};
+
+/**
+ * @brief Reads a file front to back in fixed-size chunks, without ever holding the whole file in memory.
+ *
+ * Two chunk buffers are used. While the caller works on one chunk, the next chunk is already being read into the
+ * other buffer in the background.
+ *
+ * @note A chunk returned by `next()` is only valid until the following call to `next()`.
+ */
+class FileStreamReader
+{
+  public:
+    ~FileStreamReader();
+
+    FileStreamReader(const FileStreamReader& other) = delete;
+    auto operator=(const FileStreamReader& other) -> FileStreamReader& = delete;
+    FileStreamReader(FileStreamReader&& other) noexcept;
+    auto operator=(FileStreamReader&& other) noexcept -> FileStreamReader&;
+
+    /**
+     * @brief Opens a file for streaming and starts reading the first chunk.
+     *
+     * @param file_path The path to the file.
+     * @param options Settings for chunk size, strategy, and delimiter snapping.
+     *
+     * @return A FileStreamReader if the file could be opened, std::nullopt otherwise.
+     */
+    [[nodiscard]] static auto open(std::string_view file_path, const FileStreamOptions& options = {})
+        -> std::optional<FileStreamReader>;
+
+    /**
+     * @brief Gets the next chunk of the file, blocking if it has not finished being read yet.
+     *
+     * @return A view of the chunk, or std::nullopt at the end of the file or if a read failed.
+     */
+    [[nodiscard]] auto next() -> std::optional<std::string_view>;
+
+    /**
+     * @brief The size of the file being streamed.
+     */
+    [[nodiscard]] auto file_size() const -> uint64_t;
+
+    /**
+     * @brief Whether a read has failed. Once a read fails, `next()` will always return std::nullopt.
+     */
+    [[nodiscard]] auto has_error() const -> bool;
+
+  private:
+    /**
+     * @brief The platform-specific handle to the file and its in-flight read.
+     */
+    struct NativeFile
+    {
+        intptr_t handle{-1};
+        uint64_t size{0};
+        uint64_t alignment{1};
+        std::shared_ptr<void> pending_read;
+    };
+
+    FileStreamReader() = default;
+
+    // Implemented per platform
+    static auto open_native(std::string_view file_path, bool direct) -> std::optional<NativeFile>;
+    static auto close_native(NativeFile& file) -> void;
+    static auto start_read(NativeFile& file, void* buffer, uint64_t size, uint64_t offset) -> bool;
+    static auto finish_read(NativeFile& file) -> std::optional<uint64_t>;
+
+    auto start_next_read() -> void;
+    auto release() -> void;
+
+    NativeFile native{};
+    std::optional<char> delimiter;
+    uint64_t chunk_size{0};
+    uint64_t headroom{0};
+    uint64_t buffer_alignment{1};
+    char* buffers[2]{nullptr, nullptr}; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    uint64_t read_buffer{0};
+    uint64_t next_offset{0};
+    bool read_pending{false};
+    bool error{false};
+    const char* carry{nullptr};
+    uint64_t carry_size{0};
+};
+
+/**
+ * @brief Streams a file through a callback one chunk at a time, using a FileStreamReader.
+ *
+ * @param file_path The path to the file.
+ * @param options Settings for chunk size, strategy, and delimiter snapping.
+ * @param callback Called with each chunk in order. Returning false stops the stream early.
+ *
+ * @return False if the file could not be opened or a read failed, true otherwise.
+ */
+auto for_each_chunk(std::string_view file_path,
+                    const FileStreamOptions& options,
+                    const std::function<bool(std::string_view)>& callback) -> bool;
+
+} // namespace dae::io
+
+#endif
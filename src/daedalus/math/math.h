@@ -1,12 +1,19 @@
 #ifndef DAEDALUS_MATH_MATH_H
 #define DAEDALUS_MATH_MATH_H
 
+#include <cstddef>
+
 namespace dae
 {
-static auto align_up(size_t val, size_t alignment) -> size_t
+inline constexpr auto align_up(size_t val, size_t alignment) -> size_t
 {
     return ((val + alignment - 1) / alignment) * alignment;
 }
+
+inline constexpr auto align_down(size_t val, size_t alignment) -> size_t
+{
+    return (val / alignment) * alignment;
+}
 } // namespace dae
 
 #endif
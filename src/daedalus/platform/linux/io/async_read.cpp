@@ -0,0 +1,656 @@
+#include "daedalus/platform/linux/io/async_read.h"
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+namespace dae::io
+{
+
+namespace
+{
+constexpr unsigned RING_ENTRIES = 256;
+
+// The length of a single io_uring read is a 32 bit value, so larger reads are split. 1 GiB is a multiple of any
+// direct I/O alignment.
+constexpr size_t MAX_READ_SIZE = size_t{1} << 30;
+
+// user_data used for the NOP that wakes the reaper on shutdown.
+constexpr uint64_t WAKE_USER_DATA = 0;
+
+// user_data used for cancellation requests. Neither value can be the address of an AsyncRead.
+constexpr uint64_t CANCEL_USER_DATA = 1;
+
+auto io_uring_setup(unsigned entries, io_uring_params* params) -> int
+{
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+auto io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) -> int
+{
+    return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+auto io_uring_register(int fd, unsigned opcode, void* arg, unsigned nr_args) -> int
+{
+    return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+/**
+ * @brief Checks whether the kernel behind an io_uring instance implements an opcode.
+ *
+ * @note IORING_REGISTER_PROBE arrived in 5.6, the same release as IORING_OP_READ, so an older kernel that fails the
+ * probe also lacks every opcode newer than the original set.
+ */
+auto supports_op(int ring_fd, uint8_t op) -> bool
+{
+    constexpr unsigned PROBE_OPS = 256;
+    // io_uring_probe ends in a flexible array, so it is backed by storage sized for every possible opcode.
+    std::vector<uint64_t> storage((sizeof(io_uring_probe) + (PROBE_OPS * sizeof(io_uring_probe_op))) /
+                                  sizeof(uint64_t));
+    io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(storage.data()); // NOLINT
+
+    if (io_uring_register(ring_fd, IORING_REGISTER_PROBE, probe, PROBE_OPS) < 0)
+    {
+        return false;
+    }
+    if (op > probe->last_op)
+    {
+        return false;
+    }
+    return (probe->ops[op].flags & IO_URING_OP_SUPPORTED) != 0; // NOLINT(cppcoreguidelines-pro-bounds-*)
+}
+} // namespace
+
+auto read_fully(int fd, void* buffer, size_t size, uint64_t offset, size_t alignment) -> std::optional<size_t>
+{
+    size_t total = 0;
+    while (total < size)
+    {
+        ssize_t result = pread(fd, static_cast<char*>(buffer) + total, size - total, offset + total); // NOLINT
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return std::nullopt;
+        }
+        if (result == 0)
+            break;
+
+        total += static_cast<size_t>(result);
+        if (total % alignment != 0)
+            break;
+    }
+    return total;
+}
+
+auto AsyncRead::wait() -> std::optional<size_t>
+{
+    std::unique_lock lock(mutex);
+    cv.wait(lock, [this]() -> bool { return done.load(std::memory_order_acquire); });
+
+    if (error != 0)
+    {
+        return std::nullopt;
+    }
+    return transferred.load(std::memory_order_relaxed);
+}
+
+auto AsyncRead::wait_for(std::chrono::nanoseconds timeout) -> bool
+{
+    std::unique_lock lock(mutex);
+    return cv.wait_for(lock, timeout, [this]() -> bool { return done.load(std::memory_order_acquire); });
+}
+
+auto AsyncRead::is_done() const -> bool
+{
+    return done.load(std::memory_order_acquire);
+}
+
+auto AsyncRead::bytes_transferred() const -> size_t
+{
+    return transferred.load(std::memory_order_relaxed);
+}
+
+auto AsyncRead::complete(int error_code) -> void
+{
+    {
+        std::lock_guard lock(mutex);
+        error = error_code;
+        done.store(true, std::memory_order_release);
+    }
+    cv.notify_all();
+}
+
+/**
+ * @brief The shared memory of an io_uring instance, mapped into the process.
+ */
+struct AsyncReadEngine::Ring
+{
+    Ring() = default;
+    ~Ring()
+    {
+        if (sqes != nullptr)
+            munmap(sqes, sqes_size);
+        if (cq_ptr != nullptr && cq_ptr != sq_ptr)
+            munmap(cq_ptr, cq_size);
+        if (sq_ptr != nullptr)
+            munmap(sq_ptr, sq_size);
+        if (fd >= 0)
+            close(fd);
+    }
+
+    Ring(const Ring& other) = delete;
+    auto operator=(const Ring& other) -> Ring& = delete;
+    Ring(Ring&& other) noexcept = delete;
+    auto operator=(Ring&& other) noexcept -> Ring& = delete;
+
+    /**
+     * @brief Sets up an io_uring instance and maps its rings.
+     *
+     * @return The Ring, or nullptr if io_uring is not available to this process, or the kernel is too old to
+     * support IORING_OP_READ.
+     */
+    static auto create(unsigned entries) -> std::unique_ptr<Ring>
+    {
+        io_uring_params params{};
+        std::unique_ptr<Ring> ring = std::make_unique<Ring>();
+
+        ring->fd = io_uring_setup(entries, &params);
+        if (ring->fd < 0)
+        {
+            return nullptr;
+        }
+
+        // Kernels 5.1 to 5.5 set up a ring fine, but would complete every read with -EINVAL.
+        if (!supports_op(ring->fd, IORING_OP_READ))
+        {
+            return nullptr;
+        }
+
+        ring->sq_size = params.sq_off.array + (params.sq_entries * sizeof(uint32_t));
+        ring->cq_size = params.cq_off.cqes + (params.cq_entries * sizeof(io_uring_cqe));
+        const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_mmap)
+        {
+            ring->sq_size = ring->cq_size = std::max(ring->sq_size, ring->cq_size);
+        }
+
+        ring->sq_ptr = mmap(nullptr,
+                            ring->sq_size,
+                            PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE,
+                            ring->fd,
+                            IORING_OFF_SQ_RING);
+        if (ring->sq_ptr == MAP_FAILED)
+        {
+            ring->sq_ptr = nullptr;
+            return nullptr;
+        }
+
+        if (single_mmap)
+        {
+            ring->cq_ptr = ring->sq_ptr;
+        }
+        else
+        {
+            ring->cq_ptr = mmap(nullptr,
+                                ring->cq_size,
+                                PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_POPULATE,
+                                ring->fd,
+                                IORING_OFF_CQ_RING);
+            if (ring->cq_ptr == MAP_FAILED)
+            {
+                ring->cq_ptr = nullptr;
+                return nullptr;
+            }
+        }
+
+        ring->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = mmap(nullptr,
+                          ring->sqes_size,
+                          PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE,
+                          ring->fd,
+                          IORING_OFF_SQES);
+        if (sqes == MAP_FAILED)
+        {
+            return nullptr;
+        }
+        ring->sqes = static_cast<io_uring_sqe*>(sqes);
+
+        char* sq = static_cast<char*>(ring->sq_ptr);
+        char* cq = static_cast<char*>(ring->cq_ptr);
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-pro-type-reinterpret-cast)
+        ring->sq_head = reinterpret_cast<uint32_t*>(sq + params.sq_off.head);
+        ring->sq_tail = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+        ring->sq_mask = *reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+        ring->sq_array = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+        ring->cq_head = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+        ring->cq_tail = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+        ring->cq_mask = *reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+        ring->cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-pro-type-reinterpret-cast)
+        ring->sq_entries = params.sq_entries;
+        ring->cq_entries = params.cq_entries;
+        ring->sqe_tail = *ring->sq_tail;
+
+        return ring;
+    }
+
+    /**
+     * @brief Gets the next free submission queue entry, or nullptr if the submission queue is full.
+     */
+    auto next_sqe() -> io_uring_sqe*
+    {
+        uint32_t head = std::atomic_ref(*sq_head).load(std::memory_order_acquire);
+        if (sqe_tail - head >= sq_entries)
+        {
+            return nullptr;
+        }
+
+        uint32_t index = sqe_tail & sq_mask;
+        io_uring_sqe* sqe = &sqes[index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memset(sqe, 0, sizeof(io_uring_sqe));
+        sq_array[index] = index; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        sqe_tail++;
+        pending++;
+        return sqe;
+    }
+
+    /**
+     * @brief Makes every entry handed out by next_sqe() visible to the kernel.
+     */
+    auto publish() -> void
+    {
+        std::atomic_ref(*sq_tail).store(sqe_tail, std::memory_order_release);
+    }
+
+    int fd{-1};
+    void* sq_ptr{nullptr};
+    size_t sq_size{0};
+    void* cq_ptr{nullptr};
+    size_t cq_size{0};
+    io_uring_sqe* sqes{nullptr};
+    size_t sqes_size{0};
+
+    uint32_t* sq_head{nullptr};
+    uint32_t* sq_tail{nullptr};
+    uint32_t* sq_array{nullptr};
+    uint32_t sq_mask{0};
+    uint32_t sq_entries{0};
+
+    uint32_t* cq_head{nullptr};
+    uint32_t* cq_tail{nullptr};
+    io_uring_cqe* cqes{nullptr};
+    uint32_t cq_mask{0};
+    uint32_t cq_entries{0};
+
+    // Tail of the entries handed out by next_sqe(), which is ahead of sq_tail until publish() is called.
+    uint32_t sqe_tail{0};
+    // Entries written to the submission queue that have not been handed to the kernel yet.
+    uint32_t pending{0};
+};
+
+AsyncReadEngine::AsyncReadEngine(bool allow_io_uring) : ring(allow_io_uring ? Ring::create(RING_ENTRIES) : nullptr)
+{
+    if (ring)
+    {
+        reaper = std::thread(&AsyncReadEngine::reap, this);
+        return;
+    }
+
+    const unsigned worker_count = std::clamp(std::thread::hardware_concurrency(), 2U, 8U);
+    workers.reserve(worker_count);
+    for (unsigned i = 0; i < worker_count; i++)
+    {
+        workers.emplace_back(&AsyncReadEngine::work, this);
+    }
+}
+
+AsyncReadEngine::~AsyncReadEngine()
+{
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+
+        if (ring)
+        {
+            io_uring_sqe* sqe = next_sqe_locked();
+            sqe->opcode = IORING_OP_NOP;
+            sqe->user_data = WAKE_USER_DATA;
+            flush_locked();
+        }
+    }
+    cv.notify_all();
+
+    if (reaper.joinable())
+    {
+        reaper.join();
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+auto AsyncReadEngine::get() -> AsyncReadEngine&
+{
+    static AsyncReadEngine engine;
+    return engine;
+}
+
+auto AsyncReadEngine::submit(std::shared_ptr<AsyncRead> read) -> void
+{
+    submit(std::span<const std::shared_ptr<AsyncRead>>(&read, 1));
+}
+
+auto AsyncReadEngine::submit(std::span<const std::shared_ptr<AsyncRead>> reads) -> void
+{
+    std::unique_lock lock(mutex);
+
+    if (!ring)
+    {
+        work_queue.insert(work_queue.end(), reads.begin(), reads.end());
+        lock.unlock();
+        cv.notify_all();
+        return;
+    }
+
+    for (const std::shared_ptr<AsyncRead>& read : reads)
+    {
+        if (ring_error != 0)
+        {
+            read->complete(ring_error);
+            continue;
+        }
+
+        // Never have more reads in flight than the completion queue can hold, or completions could be dropped.
+        if (in_flight.size() + cancels_in_flight >= ring->cq_entries)
+        {
+            flush_locked();
+            cv.wait(lock, [this]() -> bool {
+                return ring_error != 0 || in_flight.size() + cancels_in_flight < ring->cq_entries;
+            });
+            if (ring_error != 0)
+            {
+                read->complete(ring_error);
+                continue;
+            }
+        }
+
+        in_flight.emplace(read.get(), read);
+        queue_locked(read.get());
+    }
+
+    flush_locked();
+}
+
+auto AsyncReadEngine::cancel(AsyncRead& read) -> bool
+{
+    std::unique_lock lock(mutex);
+
+    if (read.is_done())
+    {
+        return false;
+    }
+
+    if (!ring)
+    {
+        auto it = std::ranges::find(work_queue, &read, &std::shared_ptr<AsyncRead>::get);
+        if (it == work_queue.end())
+        {
+            return false;
+        }
+
+        std::shared_ptr<AsyncRead> cancelled = std::move(*it);
+        work_queue.erase(it);
+        lock.unlock();
+        cancelled->complete(ECANCELED);
+        return true;
+    }
+
+    if (!in_flight.contains(&read))
+    {
+        return false;
+    }
+
+    read.cancelled.store(true, std::memory_order_relaxed);
+
+    if (in_flight.size() + cancels_in_flight >= ring->cq_entries)
+    {
+        // The completion queue has no room for the cancellation's own completion. The read will still stop at its
+        // next short read.
+        return true;
+    }
+
+    queue_cancel_locked(&read);
+    cancels_in_flight++;
+    flush_locked();
+    return true;
+}
+
+auto AsyncReadEngine::uses_io_uring() const -> bool
+{
+    return ring != nullptr;
+}
+
+auto AsyncReadEngine::next_sqe_locked() -> io_uring_sqe*
+{
+    io_uring_sqe* sqe = ring->next_sqe();
+    while (sqe == nullptr)
+    {
+        // flush_locked() always empties the submission queue, by handing entries to the kernel or by failing them.
+        flush_locked();
+        sqe = ring->next_sqe();
+    }
+    return sqe;
+}
+
+auto AsyncReadEngine::queue_locked(AsyncRead* read) -> void
+{
+    io_uring_sqe* sqe = next_sqe_locked();
+
+    const size_t already_read = read->transferred.load(std::memory_order_relaxed);
+
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = read->fd;
+    sqe->addr = reinterpret_cast<uint64_t>(static_cast<char*>(read->buffer) + already_read); // NOLINT
+    sqe->len = static_cast<uint32_t>(std::min(read->size - already_read, MAX_READ_SIZE));
+    sqe->off = read->offset + already_read;
+    sqe->user_data = reinterpret_cast<uint64_t>(read); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+auto AsyncReadEngine::queue_cancel_locked(AsyncRead* read) -> void
+{
+    io_uring_sqe* sqe = next_sqe_locked();
+
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = reinterpret_cast<uint64_t>(read); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    sqe->user_data = CANCEL_USER_DATA;
+}
+
+auto AsyncReadEngine::flush_locked() -> void
+{
+    ring->publish();
+    while (ring->pending > 0)
+    {
+        int submitted = io_uring_enter(ring->fd, ring->pending, 0, 0);
+        if (submitted < 0)
+        {
+            if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            drop_pending_locked(errno);
+            return;
+        }
+        ring->pending -= static_cast<uint32_t>(submitted);
+    }
+}
+
+auto AsyncReadEngine::drop_pending_locked(int error) -> void
+{
+    // Without SQPOLL the kernel only consumes entries inside io_uring_enter, which is always called under the lock, so
+    // everything between the kernel's head and our tail can be taken back.
+    const uint32_t head = std::atomic_ref(*ring->sq_head).load(std::memory_order_acquire);
+    for (uint32_t i = head; i != ring->sqe_tail; i++)
+    {
+        const io_uring_sqe& sqe = ring->sqes[ring->sq_array[i & ring->sq_mask]]; // NOLINT
+        if (sqe.user_data == WAKE_USER_DATA)
+        {
+            continue;
+        }
+        if (sqe.user_data == CANCEL_USER_DATA)
+        {
+            cancels_in_flight--;
+            continue;
+        }
+
+        AsyncRead* read = reinterpret_cast<AsyncRead*>(sqe.user_data); // NOLINT
+        read->complete(error);
+        in_flight.erase(read);
+    }
+
+    ring->sqe_tail = head;
+    ring->pending = 0;
+    ring->publish();
+    cv.notify_all();
+}
+
+auto AsyncReadEngine::fail_in_flight_locked(int error) -> void
+{
+    ring_error = error;
+    for (auto& [read, owner] : in_flight)
+    {
+        read->complete(error);
+    }
+    in_flight.clear();
+    cancels_in_flight = 0;
+    cv.notify_all();
+}
+
+auto AsyncReadEngine::reap() -> void
+{
+    while (true)
+    {
+        int result = io_uring_enter(ring->fd, 0, 1, IORING_ENTER_GETEVENTS);
+        if (result < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+        {
+            // Nothing will reap the ring any more, so nobody may be left waiting on it.
+            const int error = errno;
+            std::lock_guard lock(mutex);
+            fail_in_flight_locked(error);
+            return;
+        }
+
+        std::unique_lock lock(mutex);
+
+        uint32_t head = *ring->cq_head;
+        uint32_t tail = std::atomic_ref(*ring->cq_tail).load(std::memory_order_acquire);
+        bool requeued = false;
+        bool finished = false;
+
+        for (; head != tail; head++)
+        {
+            const io_uring_cqe& cqe = ring->cqes[head & ring->cq_mask]; // NOLINT
+            if (cqe.user_data == WAKE_USER_DATA)
+            {
+                continue;
+            }
+            if (cqe.user_data == CANCEL_USER_DATA)
+            {
+                cancels_in_flight--;
+                finished = true;
+                continue;
+            }
+
+            AsyncRead* read = reinterpret_cast<AsyncRead*>(cqe.user_data); // NOLINT
+            int error = 0;
+            bool done = true;
+
+            if (cqe.res == -EINTR || cqe.res == -EAGAIN)
+            {
+                done = false;
+            }
+            else if (cqe.res < 0)
+            {
+                error = -cqe.res;
+            }
+            else if (cqe.res > 0)
+            {
+                const uint64_t total = read->transferred.fetch_add(cqe.res, std::memory_order_relaxed) + cqe.res;
+                // Keep reading on short reads, unless an unaligned short read shows the end of the file was reached.
+                done = total >= read->size || total % read->alignment != 0;
+            }
+
+            if (!done && read->cancelled.load(std::memory_order_relaxed))
+            {
+                error = ECANCELED;
+                done = true;
+            }
+
+            if (!done)
+            {
+                queue_locked(read);
+                requeued = true;
+                continue;
+            }
+
+            read->complete(error);
+            in_flight.erase(read);
+            finished = true;
+        }
+
+        std::atomic_ref(*ring->cq_head).store(head, std::memory_order_release);
+
+        if (requeued)
+        {
+            flush_locked();
+        }
+        if (finished)
+        {
+            cv.notify_all();
+        }
+        if (stopping && in_flight.empty())
+        {
+            return;
+        }
+    }
+}
+
+auto AsyncReadEngine::work() -> void
+{
+    while (true)
+    {
+        std::unique_lock lock(mutex);
+        cv.wait(lock, [this]() -> bool { return stopping || !work_queue.empty(); });
+        if (work_queue.empty())
+        {
+            return;
+        }
+
+        std::shared_ptr<AsyncRead> read = std::move(work_queue.front());
+        work_queue.pop_front();
+        lock.unlock();
+
+        std::optional<size_t> bytes_read =
+            read_fully(read->fd, read->buffer, read->size, read->offset, read->alignment);
+        if (bytes_read)
+        {
+            read->transferred.store(bytes_read.value(), std::memory_order_relaxed);
+        }
+        read->complete(bytes_read ? 0 : EIO);
+    }
+}
+
+} // namespace dae::io
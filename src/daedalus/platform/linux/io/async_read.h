@@ -0,0 +1,187 @@
+#ifndef DAEDALUS_PLATFORM_LINUX_IO_ASYNC_READ_H
+#define DAEDALUS_PLATFORM_LINUX_IO_ASYNC_READ_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+struct io_uring_sqe;
+
+namespace dae::io
+{
+
+/**
+ * @brief Reads from a file descriptor with `pread` until the buffer is full or the end of the file is reached.
+ *
+ * @note When reading with `O_DIRECT`, a read that ends off of an alignment boundary can only mean the end of the file,
+ * and any further read would be rejected by the kernel for being unaligned.
+ *
+ * @param fd The file descriptor to read from.
+ * @param buffer The buffer to read into.
+ * @param size The number of bytes to read.
+ * @param offset The offset in the file to start reading from.
+ * @param alignment The alignment required by the file descriptor, or 1 if there is none.
+ *
+ * @return The number of bytes read, or std::nullopt if a read failed.
+ */
+[[nodiscard]] auto read_fully(int fd, void* buffer, size_t size, uint64_t offset, size_t alignment)
+    -> std::optional<size_t>;
+
+/**
+ * @brief A single positional read that is tracked by the AsyncReadEngine.
+ *
+ * @note The fd and buffer must stay valid until the read is complete. The engine keeps the AsyncRead itself alive
+ * while it is in flight.
+ */
+class AsyncRead
+{
+  public:
+    AsyncRead(int fd, void* buffer, size_t size, uint64_t offset, size_t alignment)
+        : fd(fd), buffer(buffer), size(size), offset(offset), alignment(alignment)
+    {
+    }
+
+    /**
+     * @brief Blocks until the read is complete.
+     *
+     * @return The number of bytes read, or std::nullopt if the read failed.
+     */
+    auto wait() -> std::optional<size_t>;
+
+    /**
+     * @brief Blocks until the read is complete or the timeout passes.
+     *
+     * @return Whether the read is complete.
+     */
+    auto wait_for(std::chrono::nanoseconds timeout) -> bool;
+
+    /**
+     * @brief Checks whether the read is complete without blocking.
+     */
+    [[nodiscard]] auto is_done() const -> bool;
+
+    /**
+     * @brief The number of bytes read so far. Updated as each underlying read completes.
+     */
+    [[nodiscard]] auto bytes_transferred() const -> size_t;
+
+    const int fd;
+    void* const buffer;
+    const size_t size;
+    const uint64_t offset;
+    const size_t alignment;
+
+  private:
+    friend class AsyncReadEngine;
+
+    auto complete(int error) -> void;
+
+    std::atomic<uint64_t> transferred{0};
+    std::atomic<bool> done{false};
+    // Set by AsyncReadEngine::cancel(), so that a short read is not resubmitted.
+    std::atomic<bool> cancelled{false};
+    int error{0};
+    std::mutex mutex;
+    std::condition_variable cv;
+};
+
+/**
+ * @brief A process-wide engine for positional file reads.
+ *
+ * On kernels that allow it, reads are submitted to a single shared io_uring submission ring, and every completion is
+ * reaped by one background thread. If io_uring is unavailable (old kernels, or blocked by a seccomp policy), reads are
+ * serviced by a small thread pool calling `pread` instead.
+ */
+class AsyncReadEngine
+{
+  public:
+    /**
+     * @param allow_io_uring Whether io_uring may be used. When false, the fallback thread pool is always used.
+     */
+    explicit AsyncReadEngine(bool allow_io_uring = true);
+    ~AsyncReadEngine();
+
+    AsyncReadEngine(const AsyncReadEngine& other) = delete;
+    auto operator=(const AsyncReadEngine& other) -> AsyncReadEngine& = delete;
+    AsyncReadEngine(AsyncReadEngine&& other) noexcept = delete;
+    auto operator=(AsyncReadEngine&& other) noexcept -> AsyncReadEngine& = delete;
+
+    /**
+     * @brief Gets the engine shared by the whole process, creating it on first use.
+     */
+    [[nodiscard]] static auto get() -> AsyncReadEngine&;
+
+    /**
+     * @brief Submits a single read.
+     *
+     * @param read The read to submit.
+     */
+    auto submit(std::shared_ptr<AsyncRead> read) -> void;
+
+    /**
+     * @brief Submits a batch of reads. With io_uring, the whole batch is handed to the kernel with as few
+     * `io_uring_enter` calls as the ring size allows.
+     *
+     * @param reads The reads to submit.
+     */
+    auto submit(std::span<const std::shared_ptr<AsyncRead>> reads) -> void;
+
+    /**
+     * @brief Asks for a submitted read to be abandoned. A cancelled read completes with an error.
+     *
+     * @note With io_uring, the cancellation is itself asynchronous, and a read the kernel has already finished will
+     * complete normally. With the fallback thread pool, only reads that have not been picked up by a worker yet can be
+     * cancelled.
+     *
+     * @param read The read to cancel.
+     *
+     * @return Whether cancellation was requested. False if the read is already complete or is being serviced by a
+     * worker.
+     */
+    auto cancel(AsyncRead& read) -> bool;
+
+    /**
+     * @brief Whether reads are being serviced by io_uring, as opposed to the fallback thread pool.
+     */
+    [[nodiscard]] auto uses_io_uring() const -> bool;
+
+  private:
+    struct Ring;
+
+    auto next_sqe_locked() -> io_uring_sqe*;
+    auto queue_locked(AsyncRead* read) -> void;
+    auto queue_cancel_locked(AsyncRead* read) -> void;
+    auto flush_locked() -> void;
+    auto drop_pending_locked(int error) -> void;
+    auto fail_in_flight_locked(int error) -> void;
+    auto reap() -> void;
+    auto work() -> void;
+
+    std::unique_ptr<Ring> ring;
+    std::thread reaper;
+    std::unordered_map<AsyncRead*, std::shared_ptr<AsyncRead>> in_flight;
+    // Cancellation requests submitted to the ring whose completions have not been reaped yet.
+    uint32_t cancels_in_flight{0};
+    // Set if the reaper stopped on an unexpected io_uring_enter error. Reads submitted afterwards fail with it.
+    int ring_error{0};
+
+    std::vector<std::thread> workers;
+    std::deque<std::shared_ptr<AsyncRead>> work_queue;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool stopping{false};
+};
+
+} // namespace dae::io
+
+#endif
@@ -0,0 +1,193 @@
+#include "daedalus/io/cache.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// Added in Linux 6.5. Newer syscalls share one number across architectures.
+#ifndef __NR_cachestat
+#define __NR_cachestat 451
+#endif
+
+namespace dae::io
+{
+
+namespace
+{
+/**
+ * @brief Mirrors `struct cachestat_range` from <linux/mman.h>, which older kernel headers do not have.
+ */
+struct CacheStatRange
+{
+    uint64_t off{0};
+    uint64_t len{0};
+};
+
+/**
+ * @brief Mirrors `struct cachestat` from <linux/mman.h>.
+ */
+struct CacheStat
+{
+    uint64_t nr_cache{0};
+    uint64_t nr_dirty{0};
+    uint64_t nr_writeback{0};
+    uint64_t nr_evicted{0};
+    uint64_t nr_recently_evicted{0};
+};
+
+/**
+ * @brief Opens a file read-only and gets its size.
+ *
+ * @return The file descriptor, or std::nullopt on failure.
+ */
+auto open_with_size(std::string_view file, uint64_t& size) -> std::optional<int>
+{
+    int fd = open(std::string(file).c_str(), O_RDONLY | O_CLOEXEC); // NOLINT
+    if (fd < 0)
+    {
+        return std::nullopt;
+    }
+
+    struct stat st{};
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return std::nullopt;
+    }
+
+    size = static_cast<uint64_t>(st.st_size);
+    return fd;
+}
+
+/**
+ * @brief Counts a file's cached pages with `cachestat`.
+ *
+ * @return The number of cached pages, or std::nullopt if the kernel does not support `cachestat`.
+ */
+auto count_cached_pages_cachestat(int fd) -> std::optional<uint64_t>
+{
+    // A length of 0 covers the whole file
+    CacheStatRange range{};
+    CacheStat stat{};
+    if (syscall(__NR_cachestat, fd, &range, &stat, 0) != 0)
+    {
+        return std::nullopt;
+    }
+    return stat.nr_cache;
+}
+
+/**
+ * @brief Counts a file's cached pages by mapping it and checking every page with `mincore`. Mapping the file does not
+ * fault any of it in.
+ *
+ * @return The number of cached pages, or std::nullopt on failure.
+ */
+auto count_cached_pages_mincore(int fd, uint64_t size, uint64_t page_size) -> std::optional<uint64_t>
+{
+    void* view = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    if (view == MAP_FAILED)
+    {
+        return std::nullopt;
+    }
+
+    std::vector<unsigned char> pages((size + page_size - 1) / page_size);
+    const bool success = mincore(view, size, pages.data()) == 0;
+    munmap(view, size);
+    if (!success)
+    {
+        return std::nullopt;
+    }
+
+    return static_cast<uint64_t>(std::ranges::count_if(pages, [](unsigned char page) -> bool { return page & 1; }));
+}
+} // namespace
+
+auto prefetch_file(std::string_view file_path) -> bool
+{
+    return prefetch_range(file_path, 0, UINT64_MAX);
+}
+
+auto prefetch_range(std::string_view file_path, uint64_t offset, uint64_t length) -> bool
+{
+    uint64_t size = 0;
+    std::optional<int> fd = open_with_size(file_path, size);
+    if (!fd)
+    {
+        return false;
+    }
+
+    offset = std::min(offset, size);
+    length = std::min(length, size - offset);
+
+    // readahead blocks until the reads are queued rather than completed. Filesystems that do not support it are
+    // handed the same request as advice instead.
+    bool success = readahead(fd.value(), static_cast<off_t>(offset), length) == 0;
+    if (!success)
+    {
+        success = posix_fadvise(fd.value(),
+                                static_cast<off_t>(offset),
+                                static_cast<off_t>(length),
+                                POSIX_FADV_WILLNEED) == 0;
+    }
+
+    close(fd.value());
+    return success;
+}
+
+auto evict_file(std::string_view file_path) -> bool
+{
+    int fd = open(std::string(file_path).c_str(), O_RDONLY | O_CLOEXEC); // NOLINT
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    // A length of 0 covers the whole file
+    const bool success = posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+    close(fd);
+    return success;
+}
+
+auto get_file_residency(std::string_view file_path) -> std::optional<FileResidency>
+{
+    uint64_t size = 0;
+    std::optional<int> fd = open_with_size(file_path, size);
+    if (!fd)
+    {
+        return std::nullopt;
+    }
+
+    if (size == 0)
+    {
+        close(fd.value());
+        return FileResidency{};
+    }
+
+    const uint64_t page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    std::optional<uint64_t> cached_pages = count_cached_pages_cachestat(fd.value());
+    if (!cached_pages)
+    {
+        cached_pages = count_cached_pages_mincore(fd.value(), size, page_size);
+    }
+
+    close(fd.value());
+
+    if (!cached_pages)
+    {
+        return std::nullopt;
+    }
+
+    return FileResidency{
+        .size = size,
+        // The last page is only partly file data
+        .resident_bytes = std::min(cached_pages.value() * page_size, size),
+    };
+}
+
+} // namespace dae::io
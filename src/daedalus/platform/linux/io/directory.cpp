@@ -0,0 +1,213 @@
+#include "daedalus/io/directory.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+
+namespace dae::io
+{
+
+namespace
+{
+// Big enough to read most directories with a single getdents64 call
+constexpr size_t DIRECTORY_BUFFER_SIZE = static_cast<size_t>(64) * 1024;
+
+// How many entries a stat thread takes at a time, so threads are not contending on the counter for every file
+constexpr uint64_t STAT_BATCH_SIZE = 256;
+
+/**
+ * @brief The record layout returned by `getdents64`, which glibc only exposes through `readdir`.
+ */
+struct LinuxDirent64
+{
+    uint64_t d_ino;
+    int64_t d_off;
+    uint16_t d_reclen;
+    uint8_t d_type;
+    char d_name[1]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+};
+
+auto to_entry_type(uint8_t d_type) -> DirectoryEntryType
+{
+    switch (d_type)
+    {
+    case DT_REG:
+        return DirectoryEntryType::File;
+    case DT_DIR:
+        return DirectoryEntryType::Directory;
+    case DT_LNK:
+        return DirectoryEntryType::Symlink;
+    case DT_UNKNOWN:
+        return DirectoryEntryType::Unknown;
+    default:
+        return DirectoryEntryType::Other;
+    }
+}
+
+/**
+ * @brief Looks up the type of an entry with `fstatat`, for filesystems that do not report types in their directory
+ * records.
+ */
+auto get_entry_type_at(int directory_fd, const char* name) -> DirectoryEntryType
+{
+    struct stat st{};
+    if (fstatat(directory_fd, name, &st, AT_SYMLINK_NOFOLLOW) != 0)
+    {
+        return DirectoryEntryType::Unknown;
+    }
+
+    if (S_ISREG(st.st_mode))
+    {
+        return DirectoryEntryType::File;
+    }
+    if (S_ISDIR(st.st_mode))
+    {
+        return DirectoryEntryType::Directory;
+    }
+    if (S_ISLNK(st.st_mode))
+    {
+        return DirectoryEntryType::Symlink;
+    }
+    return DirectoryEntryType::Other;
+}
+
+/**
+ * @brief Appends every entry of one directory to the listing.
+ *
+ * @return False if the directory could not be opened.
+ */
+auto read_directory(const std::string& directory_path, std::vector<std::byte>& buffer, DirectoryListing& listing)
+    -> bool
+{
+    int fd = open(directory_path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC); // NOLINT
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    // Returns 0 at the end of the directory, and stops on an error with whatever was read before it
+    for (long bytes = syscall(SYS_getdents64, fd, buffer.data(), buffer.size()); bytes > 0;
+         bytes = syscall(SYS_getdents64, fd, buffer.data(), buffer.size()))
+    {
+        for (long position = 0; position < bytes;)
+        {
+            // Records are padded by the kernel to keep each one 8 byte aligned
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            const LinuxDirent64* record = reinterpret_cast<const LinuxDirent64*>(buffer.data() + position);
+            position += record->d_reclen;
+
+            const std::string_view name(static_cast<const char*>(record->d_name));
+            if (name == "." || name == "..")
+            {
+                continue;
+            }
+
+            DirectoryEntryType type = to_entry_type(record->d_type);
+            if (type == DirectoryEntryType::Unknown)
+            {
+                type = get_entry_type_at(fd, static_cast<const char*>(record->d_name));
+            }
+            listing.add_entry(directory_path, name, type);
+        }
+    }
+
+    close(fd);
+    return true;
+}
+
+/**
+ * @brief Fills in the size of every file in the listing, with the `statx` calls split across threads.
+ */
+auto fetch_file_sizes(DirectoryListing& listing, uint32_t stat_thread_count) -> void
+{
+    const uint64_t batch_count = (listing.entries.size() + STAT_BATCH_SIZE - 1) / STAT_BATCH_SIZE;
+    const uint32_t thread_count =
+        static_cast<uint32_t>(std::clamp<uint64_t>(stat_thread_count, 1, std::max<uint64_t>(batch_count, 1)));
+
+    std::atomic<uint64_t> next_batch{0};
+
+    auto stat_batches = [&]() -> void {
+        for (uint64_t batch = next_batch.fetch_add(1); batch < batch_count; batch = next_batch.fetch_add(1))
+        {
+            const uint64_t end = std::min((batch + 1) * STAT_BATCH_SIZE, listing.entries.size());
+            for (uint64_t i = batch * STAT_BATCH_SIZE; i < end; i++)
+            {
+                DirectoryEntry& entry = listing.entries[i];
+                if (entry.type != DirectoryEntryType::File)
+                {
+                    continue;
+                }
+
+                struct statx stx{};
+                if (statx(AT_FDCWD, listing.get_path(entry).data(), AT_SYMLINK_NOFOLLOW, STATX_SIZE, &stx) == 0)
+                {
+                    entry.size = stx.stx_size;
+                }
+            }
+        }
+    };
+
+    // The calling thread stats files too, rather than sitting idle
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count - 1);
+    for (uint32_t i = 1; i < thread_count; i++)
+    {
+        threads.emplace_back(stat_batches);
+    }
+    stat_batches();
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+} // namespace
+
+auto scan_directory(std::string_view directory_path, const DirectoryScanOptions& options)
+    -> std::optional<DirectoryListing>
+{
+    DirectoryListing listing;
+    std::vector<std::byte> buffer(DIRECTORY_BUFFER_SIZE);
+
+    std::string current_path(directory_path);
+    if (!read_directory(current_path, buffer, listing))
+    {
+        return std::nullopt;
+    }
+
+    // Subdirectories are scanned breadth first, by walking the listing as it grows. They are listed even when they are
+    // not wanted in the result, so their paths can be read back out of the arena instead of being queued separately.
+    if (options.recursive)
+    {
+        for (size_t i = 0; i < listing.entries.size(); i++)
+        {
+            if (listing.entries[i].type == DirectoryEntryType::Directory)
+            {
+                current_path.assign(listing.get_path(listing.entries[i]));
+                read_directory(current_path, buffer, listing);
+            }
+        }
+    }
+
+    if (!options.include_directories)
+    {
+        std::erase_if(listing.entries,
+                      [](const DirectoryEntry& entry) -> bool { return entry.type == DirectoryEntryType::Directory; });
+    }
+
+    if (options.fetch_sizes)
+    {
+        fetch_file_sizes(listing, options.stat_thread_count);
+    }
+
+    return listing;
+}
+
+} // namespace dae::io
@@ -1,25 +1,1462 @@
 #include "daedalus/io/file.h"
 
-#include <iostream>
+#include "daedalus/io/checksum.h"
+#include "daedalus/math/math.h"
+#include "daedalus/platform/linux/io/async_read.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace dae::io
 {
+
+namespace
+{
+// The largest single read issued by load_file_parallel. A multiple of any direct I/O alignment.
+constexpr uint64_t MAX_RANGE_SIZE = uint64_t{1} << 30;
+
+// load_file_checked reads in chunks of this size, small enough for a chunk to still be in the CPU's cache when it is
+// checksummed. A multiple of any direct I/O alignment.
+constexpr uint64_t CHECKSUM_CHUNK_SIZE = static_cast<uint64_t>(1) << 20;
+constexpr size_t CHECKSUM_READS_IN_FLIGHT = 4;
+
+/**
+ * @brief A file that has been opened and had its buffer allocated, but has not been read yet.
+ */
+struct PendingLoad
+{
+    int fd{-1};
+    File file{};
+    /**
+     * @brief The offset in the file that the start of the buffer is read from.
+     */
+    uint64_t read_offset{0};
+    /**
+     * @brief The most file data the load can hold, which is less than the buffer size when the read was widened out
+     * to alignment boundaries.
+     */
+    uint64_t length{UINT64_MAX};
+};
+
+/**
+ * @brief Uses statx to query an open file descriptor for its size, modification time and direct I/O alignment.
+ *
+ * @note The alignment comes from `STATX_DIOALIGN`, which reports the logical block size of the backing block device.
+ * Filesystems that do not report it fall back to the preferred I/O block size, which is always a multiple of the
+ * logical block size.
+ *
+ * @param fd The file descriptor to query.
+ *
+ * @return A FileMetaData struct if it can be retreived.
+ */
+auto get_meta_data_from_file(int fd) -> std::optional<FileMetaData>
+{
+    struct statx stx{};
+    if (statx(fd, "", AT_EMPTY_PATH, STATX_SIZE | STATX_MTIME | STATX_DIOALIGN, &stx) != 0)
+    {
+        return std::nullopt;
+    }
+
+    uint64_t alignment = stx.stx_blksize;
+    if ((stx.stx_mask & STATX_DIOALIGN) != 0 && stx.stx_dio_offset_align != 0)
+    {
+        alignment = std::max(stx.stx_dio_mem_align, stx.stx_dio_offset_align);
+    }
+
+    return FileMetaData{
+        .size = stx.stx_size,
+        .alignment = alignment,
+        .modified_time_ns = (stx.stx_mtime.tv_sec * 1'000'000'000) + stx.stx_mtime.tv_nsec,
+    };
+}
+
+/**
+ * @brief Opens a file for reading.
+ *
+ * @param file The path to the file.
+ * @param direct Whether to bypass the page cache with `O_DIRECT`. Filesystems that do not support `O_DIRECT` (such as
+ * older versions of tmpfs) fall back to a cached open, and reads are still aligned as if it were direct.
+ * @param meta_data Filled in with the file's size and alignment.
+ *
+ * @return The file descriptor, or std::nullopt on failure.
+ */
+auto open_for_read(std::string_view file, bool direct, FileMetaData& meta_data) -> std::optional<int>
+{
+    std::string path(file);
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC | (direct ? O_DIRECT : 0)); // NOLINT
+    if (fd < 0 && direct && errno == EINVAL)
+    {
+        fd = open(path.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT
+    }
+    if (fd < 0)
+    {
+        return std::nullopt;
+    }
+
+    std::optional<FileMetaData> maybe_meta_data = get_meta_data_from_file(fd);
+    if (!maybe_meta_data)
+    {
+        close(fd);
+        return std::nullopt;
+    }
+
+    meta_data = maybe_meta_data.value();
+    return fd;
+}
+
+/**
+ * @brief Allocates a buffer for reading one region of an open file.
+ *
+ * @param fd The open file descriptor.
+ * @param meta_data The file's size and alignment.
+ * @param direct Whether the read has to be widened out to the file's alignment.
+ * @param offset The offset of the region in the file.
+ * @param length The length of the region. Cut short at the end of the file.
+ * @param pool If set, the pool to draw the buffer from.
+ *
+ * @return A PendingLoad for the region. The fd is shared, not owned.
+ */
+auto prepare_range(int fd,
+                   const FileMetaData& meta_data,
+                   bool direct,
+                   uint64_t offset,
+                   uint64_t length,
+                   FileBufferPool* pool) -> PendingLoad
+{
+    offset = std::min(offset, meta_data.size);
+    length = std::min(length, meta_data.size - offset);
+
+    if (!direct)
+    {
+        return PendingLoad{
+            .fd = fd,
+            .file = allocate_file(length, 1, pool),
+            .read_offset = offset,
+            .length = length,
+        };
+    }
+
+    // With O_DIRECT, the offset and size of every read have to be multiples of the alignment.
+    const uint64_t alignment = meta_data.alignment;
+    const uint64_t read_offset = dae::align_down(offset, alignment);
+    const uint64_t read_end = dae::align_up(offset + length, alignment);
+
+    File f = allocate_file(read_end - read_offset, alignment, pool);
+    f.data_offset = offset - read_offset;
+    return PendingLoad{
+        .fd = fd,
+        .file = f,
+        .read_offset = read_offset,
+        .length = length,
+    };
+}
+
+/**
+ * @brief Opens a file and allocates a buffer for it, ready to be read.
+ *
+ * @param file The path to the file.
+ * @param direct Whether to bypass the page cache with `O_DIRECT`.
+ * @param pool If set, the pool to draw the buffer from.
+ *
+ * @return A PendingLoad if the file could be opened and its buffer allocated.
+ */
+auto open_for_load(std::string_view file, bool direct, FileBufferPool* pool) -> std::optional<PendingLoad>
+{
+    FileMetaData meta_data{};
+    std::optional<int> fd = open_for_read(file, direct, meta_data);
+    if (!fd)
+    {
+        return std::nullopt;
+    }
+    return prepare_range(fd.value(), meta_data, direct, 0, meta_data.size, pool);
+}
+
+/**
+ * @brief Sets how much file data a PendingLoad holds once its read is complete.
+ *
+ * @param pending The load whose read completed.
+ * @param bytes_transferred The number of bytes read into the buffer, including any alignment padding at the front.
+ */
+auto set_bytes_read(PendingLoad& pending, uint64_t bytes_transferred) -> void
+{
+    const uint64_t data_bytes =
+        bytes_transferred > pending.file.data_offset ? bytes_transferred - pending.file.data_offset : 0;
+    pending.file.bytes_read = std::min(data_bytes, pending.length);
+}
+
+/**
+ * @brief Reads the entirety of a PendingLoad into its buffer and closes the file.
+ *
+ * @param pending The opened file to read.
+ *
+ * @return The File if the read succeeds. On failure the buffer is freed.
+ */
+auto finish_load(PendingLoad pending) -> std::optional<File>
+{
+    std::optional<size_t> bytes_read = read_fully(pending.fd,
+                                                  pending.file.buffer,
+                                                  pending.file.buffer_size,
+                                                  pending.read_offset,
+                                                  pending.file.alignment);
+
+    close(pending.fd);
+
+    if (!bytes_read)
+    {
+        free_file(pending.file);
+        return std::nullopt;
+    }
+
+    set_bytes_read(pending, bytes_read.value());
+    return pending.file;
+}
+
+/**
+ * @brief A FileFuture::State for a PendingLoad being read by the shared AsyncReadEngine.
+ */
+class AsyncLoadState final : public FileFuture::State
+{
+  public:
+    /**
+     * @note The read is not submitted here, so that a batch of loads can be submitted together.
+     */
+    explicit AsyncLoadState(PendingLoad pending)
+        : pending(pending), read(std::make_shared<AsyncRead>(pending.fd,
+                                                             pending.file.buffer,
+                                                             pending.file.buffer_size,
+                                                             pending.read_offset,
+                                                             pending.file.alignment))
+    {
+    }
+
+    [[nodiscard]] auto get_read() const -> const std::shared_ptr<AsyncRead>&
+    {
+        return read;
+    }
+
+    auto is_ready() -> bool override
+    {
+        return read->is_done();
+    }
+
+    auto wait_for(std::chrono::nanoseconds timeout) -> bool override
+    {
+        return read->wait_for(timeout);
+    }
+
+    auto cancel() -> bool override
+    {
+        return AsyncReadEngine::get().cancel(*read);
+    }
+
+    auto bytes_transferred() const -> uint64_t override
+    {
+        return read->bytes_transferred();
+    }
+
+    auto bytes_total() const -> uint64_t override
+    {
+        return pending.file.buffer_size;
+    }
+
+    auto get() -> std::optional<File> override
+    {
+        std::optional<size_t> bytes_read = read->wait();
+
+        close(pending.fd);
+
+        if (!bytes_read)
+        {
+            free_file(pending.file);
+            return std::nullopt;
+        }
+
+        set_bytes_read(pending, bytes_read.value());
+        return pending.file;
+    }
+
+  private:
+    PendingLoad pending;
+    std::shared_ptr<AsyncRead> read;
+};
+
+/**
+ * @brief Submits the read of a PendingLoad to the shared AsyncReadEngine.
+ *
+ * @param pending The opened file to read.
+ *
+ * @return A FileFuture tracking the read.
+ */
+auto finish_load_async(PendingLoad pending) -> FileFuture
+{
+    std::unique_ptr<AsyncLoadState> state = std::make_unique<AsyncLoadState>(pending);
+    AsyncReadEngine::get().submit(state->get_read());
+    return FileFuture(std::move(state));
+}
+
+/**
+ * @brief Reads the entirety of a PendingLoad into its buffer in chunks, checksumming each chunk as soon as it arrives
+ * while the following chunks are still being read, and closes the file.
+ *
+ * @param pending The opened file to read.
+ * @param crc Set to the CRC32C of the file data.
+ *
+ * @return The File if the read succeeds. On failure the buffer is freed.
+ */
+auto finish_load_checked(PendingLoad pending, uint32_t& crc) -> std::optional<File>
+{
+    File& f = pending.file;
+    auto* buffer = static_cast<std::byte*>(f.buffer);
+    const uint64_t chunk_size = dae::align_up(CHECKSUM_CHUNK_SIZE, f.alignment);
+
+    std::deque<std::shared_ptr<AsyncRead>> reads;
+    uint64_t next_offset = 0;
+    auto submit_next = [&]() -> void {
+        const uint64_t size = std::min(chunk_size, f.buffer_size - next_offset);
+        reads.push_back(std::make_shared<AsyncRead>(pending.fd,
+                                                    buffer + next_offset, // NOLINT
+                                                    size,
+                                                    pending.read_offset + next_offset,
+                                                    f.alignment));
+        AsyncReadEngine::get().submit(reads.back());
+        next_offset += size;
+    };
+
+    while (next_offset < f.buffer_size && reads.size() < CHECKSUM_READS_IN_FLIGHT)
+    {
+        submit_next();
+    }
+
+    crc = 0;
+    uint64_t bytes_read = 0;
+    bool at_end = false;
+    bool failed = false;
+    while (!reads.empty())
+    {
+        // Every read has to finish before the buffer can be freed, even once the load has failed
+        std::shared_ptr<AsyncRead> read = std::move(reads.front());
+        reads.pop_front();
+        std::optional<size_t> chunk_read = read->wait();
+        if (!chunk_read)
+        {
+            failed = true;
+        }
+        if (failed || at_end)
+        {
+            continue;
+        }
+
+        // Anything past the length the file had when it was opened is not part of the load
+        const uint64_t chunk_offset = read->offset - pending.read_offset;
+        const uint64_t chunk_bytes = std::min<uint64_t>(chunk_read.value(), pending.length - chunk_offset);
+        crc = crc32c(std::span<const std::byte>(buffer + chunk_offset, chunk_bytes), crc); // NOLINT
+        bytes_read += chunk_read.value();
+
+        // A short read means the end of the file was reached, and later chunks have nothing to read
+        at_end = chunk_read.value() < read->size;
+        if (!at_end && next_offset < f.buffer_size)
+        {
+            submit_next();
+        }
+    }
+
+    close(pending.fd);
+
+    if (failed)
+    {
+        free_file(f);
+        return std::nullopt;
+    }
+
+    set_bytes_read(pending, bytes_read);
+    return pending.file;
+}
+
+/**
+ * @brief Reads one region of a file opened with the standard library.
+ *
+ * @param f The open file.
+ * @param file_size The size of the file.
+ * @param offset The offset of the region in the file.
+ * @param length The length of the region. Cut short at the end of the file.
+ *
+ * @return A File struct if successful.
+ */
+auto load_range_standard_library(std::ifstream& f, uint64_t file_size, uint64_t offset, uint64_t length)
+    -> std::optional<File>
+{
+    offset = std::min(offset, file_size);
+    length = std::min(length, file_size - offset);
+
+    File file_data = allocate_file(length, 1, nullptr);
+
+    f.clear();
+    f.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+    if (!f.read(static_cast<char*>(file_data.buffer), static_cast<std::streamsize>(length)))
+    {
+        free_file(file_data);
+        return std::nullopt;
+    }
+
+    file_data.bytes_read = length;
+    return file_data;
+}
+
+/**
+ * @brief Maps one region of an open file read-only.
+ *
+ * @param fd The open file descriptor. The mapping keeps its own reference to the file.
+ * @param meta_data The file's size.
+ * @param offset The offset of the region in the file.
+ * @param length The length of the region. Cut short at the end of the file.
+ *
+ * @return A File struct whose buffer is the mapping if successful. Empty regions cannot be mapped and will fail.
+ */
+auto map_range(int fd, const FileMetaData& meta_data, uint64_t offset, uint64_t length) -> std::optional<File>
+{
+    offset = std::min(offset, meta_data.size);
+    length = std::min(length, meta_data.size - offset);
+
+    // mmap rejects a zero length, so an empty region is an empty File like with the other strategies
+    const uint64_t page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    if (length == 0)
+    {
+        return File{
+            .buffer = nullptr,
+            .buffer_size = 0,
+            .bytes_read = 0,
+            .alignment = page_size,
+            .allocation_type = AllocationType::Mapped,
+        };
+    }
+
+    // Mappings have to start on a page boundary
+    const uint64_t map_offset = dae::align_down(offset, page_size);
+    const uint64_t map_length = offset + length - map_offset;
+
+    void* view = mmap(nullptr, map_length, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(map_offset));
+    if (view == MAP_FAILED)
+    {
+        return std::nullopt;
+    }
+
+    return File{
+        .buffer = view,
+        .buffer_size = map_length,
+        .bytes_read = length,
+        .alignment = page_size,
+        .allocation_type = AllocationType::Mapped,
+        .data_offset = offset - map_offset,
+    };
+}
+
+/**
+ * @brief An implementation of load_file for FileLoadStrategy::StdLibrary
+ *
+ * @param file The path to the file.
+ * @param pool If set, the pool to draw the buffer from.
+ *
+ * @return A File struct if successful.
+ */
+auto load_file_standard_library(std::string_view file, FileBufferPool* pool) -> std::optional<File>
+{
+    // Open file
+    std::ifstream f(std::string(file), std::ios::binary | std::ios::ate);
+    if (!f.is_open())
+        return std::nullopt;
+
+    // File size
+    std::streamsize size = f.tellg();
+    if (size <= 0)
+        return std::nullopt;
+
+    File file_data = allocate_file(static_cast<uint64_t>(size), 1, pool);
+
+    f.seekg(0, std::ios::beg);
+    if (!f.read(static_cast<char*>(file_data.buffer), size))
+    {
+        free_file(file_data);
+        return std::nullopt;
+    }
+
+    file_data.bytes_read = static_cast<uint64_t>(size);
+    return file_data;
+}
+
+/**
+ * @brief An implementation of load_file_async for FileLoadStrategy::StdLibrary
+ *
+ * @param file The path to the file.
+ * @param pool If set, the pool to draw the buffer from.
+ *
+ * @return A FileFuture that will optionally return a File struct if it succeeds.
+ */
+auto load_file_standard_library_async(std::string_view file, FileBufferPool* pool) -> std::optional<FileFuture>
+{
+    return FileFuture::from_future(
+        std::async(std::launch::async, load_file_standard_library, std::string(file), pool));
+}
+
+/**
+ * @brief An implementation of load_file for FileLoadStrategy::AllowCached
+ *
+ * @param file The path to the file.
+ * @param pool If set, the pool to draw the buffer from.
+ *
+ * @return A File struct if successful.
+ */
+auto load_file_allow_cached(std::string_view file, FileBufferPool* pool) -> std::optional<File>
+{
+    std::optional<PendingLoad> pending = open_for_load(file, false, pool);
+    if (!pending)
+    {
+        return std::nullopt;
+    }
+    return finish_load(pending.value());
+}
+
+/**
+ * @brief An implementation of load_file_async for FileLoadStrategy::AllowCached
+ *
+ * @param file The path to the file.
+ * @param pool If set, the pool to draw the buffer from.
+ *
+ * @return A FileFuture that will optionally return a File struct if it succeeds.
+ */
+auto load_file_allow_cached_async(std::string_view file, FileBufferPool* pool) -> std::optional<FileFuture>
+{
+    std::optional<PendingLoad> pending = open_for_load(file, false, pool);
+    if (!pending)
+    {
+        return std::nullopt;
+    }
+    return finish_load_async(pending.value());
+}
+
+/**
+ * @brief An implementation of load_file for FileLoadStrategy::SafeDirectDisk
+ *
+ * @param file The path to the file.
+ * @param pool If set, the pool to draw the buffer from.
+ *
+ * @return A File struct if successful.
+ */
+auto load_file_safe_direct_disk(std::string_view file, FileBufferPool* pool) -> std::optional<File>
+{
+    std::optional<PendingLoad> pending = open_for_load(file, true, pool);
+    if (!pending)
+    {
+        return std::nullopt;
+    }
+    return finish_load(pending.value());
+}
+
+/**
+ * @brief An implementation of load_file_async for FileLoadStrategy::SafeDirectDisk
+ *
+ * @param file The path to the file.
+ * @param pool If set, the pool to draw the buffer from.
+ *
+ * @return A FileFuture that will optionally return a File struct if it succeeds.
+ */
+auto load_file_safe_direct_disk_async(std::string_view file, FileBufferPool* pool) -> std::optional<FileFuture>
+{
+    std::optional<PendingLoad> pending = open_for_load(file, true, pool);
+    if (!pending)
+    {
+        return std::nullopt;
+    }
+    return finish_load_async(pending.value());
+}
+
+/**
+ * @brief An implementation of load_file_async for FileLoadStrategy::Mapped
+ *
+ * @note Creating the mapping does not read the file, so the mapping is created up front and the FileFuture is ready
+ * immediately.
+ *
+ * @param file The path to the file.
+ *
+ * @return A FileFuture that will optionally return a File struct if it succeeds.
+ */
+auto load_file_mapped_async(std::string_view file) -> std::optional<FileFuture>
+{
+    std::optional<File> f = load_file_mapped(file, MappedLoadHint::Lazy);
+    if (!f)
+    {
+        return std::nullopt;
+    }
+    return FileFuture::from_result(f);
+}
+
+/**
+ * @brief A file that is being written, but has not been closed and moved into place yet.
+ */
+struct PendingSave
+{
+    int fd{-1};
+    std::string write_path;
+    std::string final_path;
+};
+
+/**
+ * @brief Builds a unique path in the same directory as a file, to write to before renaming over the file.
+ *
+ * @param file_path The path to the destination file.
+ *
+ * @return A path that no other save in any process will pick.
+ */
+auto make_temporary_path(std::string_view file_path) -> std::string
+{
+    static std::atomic<uint64_t> counter{0};
+    return std::string(file_path) + ".tmp." + std::to_string(getpid()) + "." +
+           std::to_string(counter.fetch_add(1, std::memory_order_relaxed));
+}
+
+/**
+ * @brief Gives a temporary file the permission bits and owner of the file it is about to be renamed over, so that an
+ * atomic replace does not reset them to the defaults for a new file.
+ *
+ * @param fd The temporary file.
+ * @param final_path The path to the destination file.
+ *
+ * @return True if the permissions were copied, or there is no destination file yet.
+ */
+auto copy_permissions(int fd, const std::string& final_path) -> bool
+{
+    struct stat existing{};
+    if (stat(final_path.c_str(), &existing) != 0)
+    {
+        return errno == ENOENT;
+    }
+
+    // Only a privileged process can give a file away, so this is best effort. It goes first because changing the owner
+    // can clear the setuid and setgid bits.
+    (void)fchown(fd, existing.st_uid, existing.st_gid);
+    return fchmod(fd, existing.st_mode & 07777) == 0;
+}
+
+/**
+ * @brief Opens the file a save should write to, which is a temporary file when replacing atomically.
+ *
+ * @param file The path to the destination file.
+ * @param options The settings for the save.
+ *
+ * @return A PendingSave if the file could be opened.
+ */
+auto open_for_save(std::string_view file, const FileSaveOptions& options) -> std::optional<PendingSave>
+{
+    PendingSave pending{
+        .write_path = options.atomic_replace ? make_temporary_path(file) : std::string(file),
+        .final_path = std::string(file),
+    };
+
+    const bool direct = options.save_strategy == FileLoadStrategy::SafeDirectDisk;
+    const int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (options.atomic_replace ? O_EXCL : O_TRUNC);
+
+    pending.fd = open(pending.write_path.c_str(), flags | (direct ? O_DIRECT : 0), 0666); // NOLINT
+    if (pending.fd < 0 && direct && errno == EINVAL)
+    {
+        pending.fd = open(pending.write_path.c_str(), flags, 0666); // NOLINT
+    }
+    if (pending.fd < 0)
+    {
+        return std::nullopt;
+    }
+
+    if (options.atomic_replace && !copy_permissions(pending.fd, pending.final_path))
+    {
+        close(pending.fd);
+        unlink(pending.write_path.c_str());
+        return std::nullopt;
+    }
+
+    return pending;
+}
+
+/**
+ * @brief Writes to a file descriptor with `pwrite` until the whole buffer is written.
+ *
+ * @return True if every byte was written.
+ */
+auto write_fully(int fd, const void* buffer, size_t size, uint64_t offset) -> bool
+{
+    size_t total = 0;
+    while (total < size)
+    {
+        ssize_t result = pwrite(fd, static_cast<const char*>(buffer) + total, size - total, offset + total); // NOLINT
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        total += static_cast<size_t>(result);
+    }
+    return true;
+}
+
+/**
+ * @brief Writes a buffer to a file opened with `O_DIRECT`, where every write must be aligned in memory, in offset and
+ * in size.
+ *
+ * @note If the buffer is aligned, everything but the final partial block is written straight from it. Otherwise the
+ * data is copied through an aligned staging buffer. The final partial block is padded out to a whole block, and the
+ * padding is cut off afterwards with `ftruncate`.
+ *
+ * @return True if every byte was written.
+ */
+auto write_direct(int fd, std::span<const std::byte> data, size_t alignment) -> bool
+{
+    constexpr size_t STAGING_SIZE = static_cast<size_t>(1024) * 1024;
+
+    const bool buffer_aligned = reinterpret_cast<uintptr_t>(data.data()) % alignment == 0; // NOLINT
+    const size_t whole_blocks_size = data.size() - (data.size() % alignment);
+    const size_t staging_size = buffer_aligned ? alignment : dae::align_up(STAGING_SIZE, alignment);
+
+    std::byte* staging = static_cast<std::byte*>(::operator new(staging_size, std::align_val_t(alignment)));
+
+    bool success = true;
+    size_t written = 0;
+    if (buffer_aligned)
+    {
+        success = write_fully(fd, data.data(), whole_blocks_size, 0);
+        written = whole_blocks_size;
+    }
+
+    while (success && written < data.size())
+    {
+        const size_t size = std::min(staging_size, data.size() - written);
+        const size_t padded_size = dae::align_up(size, alignment);
+        std::memcpy(staging, data.data() + written, size);   // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memset(staging + size, 0, padded_size - size); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        success = write_fully(fd, staging, padded_size, written);
+        written += size;
+    }
+
+    ::operator delete(staging, std::align_val_t(alignment));
+
+    return success && ftruncate(fd, static_cast<off_t>(data.size())) == 0;
+}
+
+/**
+ * @brief Writes the contents of a save.
+ *
+ * @return True if every byte was written.
+ */
+auto write_save(const PendingSave& pending, std::span<const std::byte> data) -> bool
+{
+    const int status_flags = fcntl(pending.fd, F_GETFL);
+    if (status_flags < 0 || (status_flags & O_DIRECT) == 0)
+    {
+        return write_fully(pending.fd, data.data(), data.size(), 0);
+    }
+
+    std::optional<FileMetaData> meta_data = get_meta_data_from_file(pending.fd);
+    if (!meta_data)
+    {
+        return false;
+    }
+    return write_direct(pending.fd, data, meta_data->alignment);
+}
+
+/**
+ * @brief Flushes a written file as far as the sync mode asks for.
+ *
+ * @return True if the flush succeeded.
+ */
+auto sync_save(int fd, FileSyncMode sync_mode) -> bool
+{
+    switch (sync_mode)
+    {
+    case FileSyncMode::Data:
+        return fdatasync(fd) == 0;
+    case FileSyncMode::Full:
+        return fsync(fd) == 0;
+    default:
+        return true;
+    }
+}
+
+/**
+ * @brief Flushes the directory holding a file, so that a rename into it survives a crash.
+ */
+auto sync_parent_directory(std::string_view file) -> void
+{
+    size_t separator = file.find_last_of('/');
+    std::string directory = ".";
+    if (separator != std::string_view::npos)
+    {
+        // Keep the slash of a file in the root directory
+        directory = file.substr(0, std::max<size_t>(separator, 1));
+    }
+    int fd = open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC); // NOLINT
+    if (fd >= 0)
+    {
+        fsync(fd);
+        close(fd);
+    }
+}
+
+/**
+ * @brief Closes a written file and, when replacing atomically, renames it over the destination. On failure, any
+ * temporary file is removed.
+ *
+ * @param pending The save to finish.
+ * @param success Whether the save has succeeded so far.
+ * @param options The settings for the save.
+ *
+ * @return True if the save succeeded.
+ */
+auto finish_save(PendingSave& pending, bool success, const FileSaveOptions& options) -> bool
+{
+    success = close(pending.fd) == 0 && success;
+    pending.fd = -1;
+
+    if (!options.atomic_replace)
+    {
+        return success;
+    }
+
+    if (success && rename(pending.write_path.c_str(), pending.final_path.c_str()) == 0)
+    {
+        return true;
+    }
+
+    unlink(pending.write_path.c_str());
+    return false;
+}
+
+/**
+ * @brief An implementation of save_file for FileLoadStrategy::StdLibrary
+ *
+ * @note std::ofstream cannot flush to disk, so a requested sync reopens the file to flush it.
+ */
+auto save_file_standard_library(std::string_view file, std::span<const std::byte> data, const FileSaveOptions& options)
+    -> bool
+{
+    std::string write_path = options.atomic_replace ? make_temporary_path(file) : std::string(file);
+
+    std::ofstream f(write_path, std::ios::binary | std::ios::trunc);
+    if (!f.is_open())
+        return false;
+
+    f.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())); // NOLINT
+    f.close();
+    bool success = !f.fail();
+
+    if (success && (options.atomic_replace || options.sync_mode != FileSyncMode::None))
+    {
+        int fd = open(write_path.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT
+        success = fd >= 0;
+        if (success && options.atomic_replace)
+            success = copy_permissions(fd, std::string(file));
+        if (success && options.sync_mode != FileSyncMode::None)
+            success = sync_save(fd, options.sync_mode);
+        if (fd >= 0)
+            close(fd);
+    }
+
+    if (!options.atomic_replace)
+    {
+        return success;
+    }
+
+    std::error_code error;
+    if (success)
+    {
+        std::filesystem::rename(write_path, std::string(file), error);
+    }
+    if (!success || error)
+    {
+        std::filesystem::remove(write_path, error);
+        return false;
+    }
+
+    if (options.sync_mode != FileSyncMode::None)
+    {
+        sync_parent_directory(file);
+    }
+    return true;
+}
+
+} // namespace
+
+namespace
+{
+/**
+ * @brief Dispatches load_file to the implementation for a strategy.
+ */
+auto load_file_with_strategy(std::string_view file, FileLoadStrategy load_strategy, FileBufferPool* pool)
+    -> std::optional<File>
+{
+    switch (load_strategy)
+    {
+    case FileLoadStrategy::StdLibrary:
+        return load_file_standard_library(file, pool);
+    case FileLoadStrategy::AllowCached:
+        return load_file_allow_cached(file, pool);
+    case FileLoadStrategy::SafeDirectDisk:
+        return load_file_safe_direct_disk(file, pool);
+    case FileLoadStrategy::Mapped:
+        return load_file_mapped(file, MappedLoadHint::Lazy);
+    default:
+        return std::nullopt;
+    }
+}
+} // namespace
+
 auto load_file(std::string_view file, FileLoadStrategy load_strategy) -> std::optional<File>
 {
-    std::cerr << "daedalus::fileio::load_file() UNIMPLEMENTED ON LINUX \n";
-    return std::nullopt;
+    return load_file_with_strategy(file, load_strategy, nullptr);
+}
+
+auto load_file(std::string_view file, FileLoadStrategy load_strategy, FileBufferPool& pool) -> std::optional<File>
+{
+    return load_file_with_strategy(file, load_strategy, &pool);
+}
+
+auto load_file_mapped(std::string_view file, MappedLoadHint hint) -> std::optional<File>
+{
+    int fd = open(std::string(file).c_str(), O_RDONLY | O_CLOEXEC); // NOLINT
+    if (fd < 0)
+    {
+        return std::nullopt;
+    }
+
+    std::optional<FileMetaData> maybe_meta_data = get_meta_data_from_file(fd);
+    if (!maybe_meta_data)
+    {
+        close(fd);
+        return std::nullopt;
+    }
+    size_t file_size = maybe_meta_data->size;
+
+    // mmap rejects a zero length, so there is nothing to map
+    if (file_size == 0)
+    {
+        close(fd);
+        return File{
+            .buffer = nullptr,
+            .buffer_size = 0,
+            .bytes_read = 0,
+            .alignment = static_cast<uint64_t>(sysconf(_SC_PAGESIZE)),
+            .allocation_type = AllocationType::Mapped,
+        };
+    }
+
+    // MAP_POPULATE faults in every page before mmap returns
+    int flags = MAP_PRIVATE | (hint == MappedLoadHint::Prefault ? MAP_POPULATE : 0);
+    void* view = mmap(nullptr, file_size, PROT_READ, flags, fd, 0);
+
+    // The mapping keeps its own reference to the file
+    close(fd);
+
+    if (view == MAP_FAILED)
+    {
+        return std::nullopt;
+    }
+
+    if (hint == MappedLoadHint::Sequential)
+    {
+        madvise(view, file_size, MADV_SEQUENTIAL);
+        madvise(view, file_size, MADV_WILLNEED);
+    }
+
+    return File{
+        .buffer = view,
+        .buffer_size = file_size,
+        .bytes_read = file_size,
+        .alignment = static_cast<uint64_t>(sysconf(_SC_PAGESIZE)),
+        .allocation_type = AllocationType::Mapped,
+    };
+}
+
+auto load_file_range(std::string_view file, uint64_t offset, uint64_t length, FileLoadStrategy load_strategy)
+    -> std::optional<File>
+{
+    const bool direct = load_strategy == FileLoadStrategy::SafeDirectDisk;
+    switch (load_strategy)
+    {
+    case FileLoadStrategy::StdLibrary: {
+        std::ifstream f(std::string(file), std::ios::binary | std::ios::ate);
+        if (!f.is_open())
+        {
+            return std::nullopt;
+        }
+        const std::streamoff file_size = f.tellg();
+        if (file_size < 0)
+        {
+            return std::nullopt;
+        }
+        return load_range_standard_library(f, static_cast<uint64_t>(file_size), offset, length);
+    }
+    case FileLoadStrategy::AllowCached:
+    case FileLoadStrategy::SafeDirectDisk: {
+        FileMetaData meta_data{};
+        std::optional<int> fd = open_for_read(file, direct, meta_data);
+        if (!fd)
+        {
+            return std::nullopt;
+        }
+        return finish_load(prepare_range(fd.value(), meta_data, direct, offset, length, nullptr));
+    }
+    case FileLoadStrategy::Mapped: {
+        FileMetaData meta_data{};
+        std::optional<int> fd = open_for_read(file, false, meta_data);
+        if (!fd)
+        {
+            return std::nullopt;
+        }
+        std::optional<File> f = map_range(fd.value(), meta_data, offset, length);
+        close(fd.value());
+        return f;
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+auto load_file_range_async(std::string_view file, uint64_t offset, uint64_t length, FileLoadStrategy load_strategy)
+    -> std::optional<FileFuture>
+{
+    const bool direct = load_strategy == FileLoadStrategy::SafeDirectDisk;
+    switch (load_strategy)
+    {
+    case FileLoadStrategy::StdLibrary:
+        return FileFuture::from_future(
+            std::async(std::launch::async, load_file_range, std::string(file), offset, length, load_strategy));
+    case FileLoadStrategy::AllowCached:
+    case FileLoadStrategy::SafeDirectDisk: {
+        FileMetaData meta_data{};
+        std::optional<int> fd = open_for_read(file, direct, meta_data);
+        if (!fd)
+        {
+            return std::nullopt;
+        }
+        return finish_load_async(prepare_range(fd.value(), meta_data, direct, offset, length, nullptr));
+    }
+    case FileLoadStrategy::Mapped: {
+        // Creating the mapping does not read the file, so the FileFuture is ready immediately
+        std::optional<File> f = load_file_range(file, offset, length, load_strategy);
+        if (!f)
+        {
+            return std::nullopt;
+        }
+        return FileFuture::from_result(f);
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+auto load_file_ranges(std::string_view file, std::span<const FileRange> ranges, FileLoadStrategy load_strategy)
+    -> std::vector<std::optional<File>>
+{
+    std::vector<std::optional<File>> files(ranges.size());
+    const bool direct = load_strategy == FileLoadStrategy::SafeDirectDisk;
+
+    if (load_strategy == FileLoadStrategy::StdLibrary)
+    {
+        std::ifstream f(std::string(file), std::ios::binary | std::ios::ate);
+        if (!f.is_open())
+        {
+            return files;
+        }
+        const std::streamoff file_size = f.tellg();
+        if (file_size < 0)
+        {
+            return files;
+        }
+        for (size_t i = 0; i < ranges.size(); i++)
+        {
+            files[i] = load_range_standard_library(f,
+                                                  static_cast<uint64_t>(file_size),
+                                                  ranges[i].offset,
+                                                  ranges[i].length);
+        }
+        return files;
+    }
+
+    if (load_strategy != FileLoadStrategy::AllowCached && load_strategy != FileLoadStrategy::SafeDirectDisk &&
+        load_strategy != FileLoadStrategy::Mapped)
+    {
+        return files;
+    }
+
+    FileMetaData meta_data{};
+    std::optional<int> fd = open_for_read(file, direct, meta_data);
+    if (!fd)
+    {
+        return files;
+    }
+
+    if (load_strategy == FileLoadStrategy::Mapped)
+    {
+        for (size_t i = 0; i < ranges.size(); i++)
+        {
+            files[i] = map_range(fd.value(), meta_data, ranges[i].offset, ranges[i].length);
+        }
+        close(fd.value());
+        return files;
+    }
+
+    // Every read is handed to the engine in one batch, so they can all be in flight at once
+    std::vector<PendingLoad> pending;
+    std::vector<std::shared_ptr<AsyncRead>> reads;
+    pending.reserve(ranges.size());
+    reads.reserve(ranges.size());
+    for (const FileRange& range : ranges)
+    {
+        const PendingLoad& load =
+            pending.emplace_back(prepare_range(fd.value(), meta_data, direct, range.offset, range.length, nullptr));
+        reads.push_back(std::make_shared<AsyncRead>(load.fd,
+                                                    load.file.buffer,
+                                                    load.file.buffer_size,
+                                                    load.read_offset,
+                                                    load.file.alignment));
+    }
+    AsyncReadEngine::get().submit(reads);
+
+    for (size_t i = 0; i < ranges.size(); i++)
+    {
+        std::optional<size_t> bytes_read = reads[i]->wait();
+        if (!bytes_read)
+        {
+            free_file(pending[i].file);
+            continue;
+        }
+        set_bytes_read(pending[i], bytes_read.value());
+        files[i] = pending[i].file;
+    }
+
+    close(fd.value());
+    return files;
+}
+
+auto load_file_parallel(std::string_view file, const FileParallelLoadOptions& options, FileParallelLoadStats* stats)
+    -> std::optional<File>
+{
+    std::optional<PendingLoad> pending =
+        open_for_load(file, options.load_strategy == FileLoadStrategy::SafeDirectDisk, options.pool);
+    if (!pending)
+    {
+        return std::nullopt;
+    }
+
+    File& f = pending->file;
+    const uint64_t range_size = dae::align_up(std::clamp<uint64_t>(options.range_size, 1, MAX_RANGE_SIZE), f.alignment);
+    const uint64_t range_count = (f.buffer_size + range_size - 1) / range_size;
+    const uint32_t thread_count =
+        static_cast<uint32_t>(std::clamp<uint64_t>(options.thread_count, 1, std::max<uint64_t>(range_count, 1)));
+
+    std::atomic<uint64_t> next_range{0};
+    std::atomic<uint64_t> bytes_read{0};
+    std::atomic<bool> failed{false};
+
+    auto read_ranges = [&]() -> void {
+        for (uint64_t range = next_range.fetch_add(1); range < range_count && !failed.load(std::memory_order_relaxed);
+             range = next_range.fetch_add(1))
+        {
+            const uint64_t offset = range * range_size;
+            const uint64_t size = std::min(range_size, f.buffer_size - offset);
+            std::optional<size_t> range_read =
+                read_fully(pending->fd, static_cast<char*>(f.buffer) + offset, size, offset, f.alignment); // NOLINT
+            if (!range_read)
+            {
+                failed.store(true, std::memory_order_relaxed);
+                return;
+            }
+            bytes_read.fetch_add(range_read.value(), std::memory_order_relaxed);
+        }
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+
+    // The calling thread reads ranges too, rather than sitting idle
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count - 1);
+    for (uint32_t i = 1; i < thread_count; i++)
+    {
+        threads.emplace_back(read_ranges);
+    }
+    read_ranges();
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    const std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - start;
+
+    close(pending->fd);
+
+    if (failed.load())
+    {
+        free_file(f);
+        return std::nullopt;
+    }
+
+    f.bytes_read = bytes_read.load();
+
+    if (stats != nullptr)
+    {
+        const double seconds = std::chrono::duration<double>(duration).count();
+        *stats = FileParallelLoadStats{
+            .bytes_read = f.bytes_read,
+            .range_count = range_count,
+            .thread_count = thread_count,
+            .duration = duration,
+            .bytes_per_second = seconds > 0.0 ? static_cast<double>(f.bytes_read) / seconds : 0.0,
+        };
+    }
+
+    return f;
+}
+
+auto load_file_checked(std::string_view file,
+                       std::optional<uint32_t> expected_crc32c,
+                       FileLoadStrategy load_strategy,
+                       uint32_t* crc32c) -> std::optional<File>
+{
+    uint32_t crc = 0;
+    std::optional<File> f;
+    if (load_strategy == FileLoadStrategy::AllowCached || load_strategy == FileLoadStrategy::SafeDirectDisk)
+    {
+        std::optional<PendingLoad> pending =
+            open_for_load(file, load_strategy == FileLoadStrategy::SafeDirectDisk, nullptr);
+        if (!pending)
+        {
+            return std::nullopt;
+        }
+        f = finish_load_checked(pending.value(), crc);
+    }
+    else
+    {
+        f = load_file(file, load_strategy);
+        if (f)
+        {
+            crc = dae::io::crc32c(get_file_data(f.value()));
+        }
+    }
+
+    if (!f)
+    {
+        return std::nullopt;
+    }
+
+    if (crc32c != nullptr)
+    {
+        *crc32c = crc;
+    }
+
+    if (expected_crc32c && expected_crc32c.value() != crc)
+    {
+        free_file(f.value());
+        return std::nullopt;
+    }
+    return f;
+}
+
+namespace
+{
+/**
+ * @brief Dispatches load_file_async to the implementation for a strategy.
+ */
+auto load_file_async_with_strategy(std::string_view file, FileLoadStrategy load_strategy, FileBufferPool* pool)
+    -> std::optional<FileFuture>
+{
+    switch (load_strategy)
+    {
+    case FileLoadStrategy::StdLibrary:
+        return load_file_standard_library_async(file, pool);
+    case FileLoadStrategy::AllowCached:
+        return load_file_allow_cached_async(file, pool);
+    case FileLoadStrategy::SafeDirectDisk:
+        return load_file_safe_direct_disk_async(file, pool);
+    case FileLoadStrategy::Mapped:
+        return load_file_mapped_async(file);
+    default:
+        return std::nullopt;
+    }
+}
+} // namespace
+
+auto load_file_async(std::string_view file, FileLoadStrategy load_strategy) -> std::optional<FileFuture>
+{
+    return load_file_async_with_strategy(file, load_strategy, nullptr);
+}
+
+auto load_file_async(std::string_view file, FileLoadStrategy load_strategy, FileBufferPool& pool)
+    -> std::optional<FileFuture>
+{
+    return load_file_async_with_strategy(file, load_strategy, &pool);
+}
+
+auto load_files_async(std::span<const std::string_view> file_paths, FileLoadStrategy load_strategy)
+    -> std::vector<std::optional<FileFuture>>
+{
+    std::vector<std::optional<FileFuture>> futures(file_paths.size());
+
+    if (load_strategy != FileLoadStrategy::AllowCached && load_strategy != FileLoadStrategy::SafeDirectDisk)
+    {
+        for (size_t i = 0; i < file_paths.size(); i++)
+        {
+            futures[i] = load_file_async_with_strategy(file_paths[i], load_strategy, nullptr);
+        }
+        return futures;
+    }
+
+    // Open everything first, then hand every read to the engine in one submission
+    const bool direct = load_strategy == FileLoadStrategy::SafeDirectDisk;
+    std::vector<std::shared_ptr<AsyncRead>> reads;
+    reads.reserve(file_paths.size());
+    for (size_t i = 0; i < file_paths.size(); i++)
+    {
+        std::optional<PendingLoad> pending = open_for_load(file_paths[i], direct, nullptr);
+        if (!pending)
+        {
+            continue;
+        }
+        std::unique_ptr<AsyncLoadState> state = std::make_unique<AsyncLoadState>(pending.value());
+        reads.push_back(state->get_read());
+        futures[i] = FileFuture(std::move(state));
+    }
+
+    AsyncReadEngine::get().submit(reads);
+    return futures;
+}
+
+auto save_file(std::string_view file, std::span<const std::byte> data, const FileSaveOptions& options) -> bool
+{
+    if (options.save_strategy == FileLoadStrategy::StdLibrary)
+    {
+        return save_file_standard_library(file, data, options);
+    }
+    if (options.save_strategy != FileLoadStrategy::AllowCached &&
+        options.save_strategy != FileLoadStrategy::SafeDirectDisk)
+    {
+        return false;
+    }
+
+    std::optional<PendingSave> pending = open_for_save(file, options);
+    if (!pending)
+    {
+        return false;
+    }
+
+    bool success = write_save(pending.value(), data) && sync_save(pending->fd, options.sync_mode);
+    success = finish_save(pending.value(), success, options);
+
+    if (success && options.atomic_replace && options.sync_mode != FileSyncMode::None)
+    {
+        sync_parent_directory(file);
+    }
+    return success;
 }
 
-auto load_file_async(std::string_view file, FileLoadStrategy load_strategy)
-    -> std::optional<std::move_only_function<std::optional<File>()>>
+auto save_files(std::span<const FileSaveRequest> requests, const FileSaveOptions& options) -> std::vector<bool>
 {
-    std::cerr << "daedalus::fileio::load_file_async() UNIMPLEMENTED ON LINUX \n";
-    return std::nullopt;
+    std::vector<bool> results(requests.size(), false);
+
+    if (options.save_strategy == FileLoadStrategy::StdLibrary)
+    {
+        for (size_t i = 0; i < requests.size(); i++)
+        {
+            results[i] = save_file_standard_library(requests[i].file_path, requests[i].data, options);
+        }
+        return results;
+    }
+    if (options.save_strategy != FileLoadStrategy::AllowCached &&
+        options.save_strategy != FileLoadStrategy::SafeDirectDisk)
+    {
+        return results;
+    }
+
+    // Write everything first
+    std::vector<std::optional<PendingSave>> pending(requests.size());
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        pending[i] = open_for_save(requests[i].file_path, options);
+        if (pending[i])
+        {
+            results[i] = write_save(pending[i].value(), requests[i].data);
+        }
+    }
+
+    if (options.sync_mode != FileSyncMode::None)
+    {
+        // Start writeback for the whole batch so the device sees every file at once, then wait on each file
+        for (size_t i = 0; i < requests.size(); i++)
+        {
+            if (results[i])
+            {
+                sync_file_range(pending[i]->fd, 0, 0, SYNC_FILE_RANGE_WRITE);
+            }
+        }
+        for (size_t i = 0; i < requests.size(); i++)
+        {
+            if (results[i])
+            {
+                results[i] = sync_save(pending[i]->fd, options.sync_mode);
+            }
+        }
+    }
+
+    std::vector<std::string_view> synced_directories;
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        if (!pending[i])
+        {
+            continue;
+        }
+
+        results[i] = finish_save(pending[i].value(), results[i], options);
+
+        if (results[i] && options.atomic_replace && options.sync_mode != FileSyncMode::None)
+        {
+            std::string_view file = requests[i].file_path;
+            std::string_view directory = file.substr(0, file.find_last_of('/') + 1);
+            if (std::ranges::find(synced_directories, directory) == synced_directories.end())
+            {
+                synced_directories.push_back(directory);
+                sync_parent_directory(file);
+            }
+        }
+    }
+
+    return results;
 }
 
 auto get_file_meta_data(std::string_view file) -> std::optional<FileMetaData>
 {
-    std::cerr << "daedalus::fileio::get_file_meta_data() UNIMPLEMENTED ON LINUX \n";
-    return std::nullopt;
+    int fd = open(std::string(file).c_str(), O_RDONLY | O_CLOEXEC); // NOLINT
+    if (fd < 0)
+    {
+        return std::nullopt;
+    }
+
+    std::optional<FileMetaData> meta_data = get_meta_data_from_file(fd);
+
+    close(fd);
+
+    return meta_data;
 }
+
 } // namespace dae::io
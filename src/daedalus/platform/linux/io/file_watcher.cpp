@@ -0,0 +1,116 @@
+#include "daedalus/io/file_watcher.h"
+
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+namespace dae::io
+{
+
+namespace
+{
+// Writes are reported once the writer closes the file rather than on every write, and renames are reported on both
+// sides, so files saved by renaming a temporary file over them are seen
+constexpr uint32_t WATCH_MASK = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+
+constexpr size_t EVENT_BUFFER_SIZE = static_cast<size_t>(16) * 1024;
+
+auto to_change_type(uint32_t mask) -> FileChangeType
+{
+    if ((mask & (IN_DELETE | IN_MOVED_FROM)) != 0)
+    {
+        return FileChangeType::Removed;
+    }
+    if ((mask & IN_CREATE) != 0)
+    {
+        return FileChangeType::Created;
+    }
+    // A file renamed in over a name may or may not be replacing a file, and is treated as the file being rewritten
+    return FileChangeType::Modified;
+}
+} // namespace
+
+auto FileWatcher::open_native() -> std::optional<intptr_t>
+{
+    int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0)
+    {
+        return std::nullopt;
+    }
+    return fd;
+}
+
+auto FileWatcher::close_native() -> void
+{
+    close(static_cast<int>(handle));
+}
+
+auto FileWatcher::add_native_watch(Watch& watch) -> bool
+{
+    int wd = inotify_add_watch(static_cast<int>(handle), watch.directory.c_str(), WATCH_MASK | IN_ONLYDIR);
+    if (wd < 0)
+    {
+        return false;
+    }
+    watch.handle = wd;
+    return true;
+}
+
+auto FileWatcher::remove_native_watch(Watch& watch) -> void
+{
+    inotify_rm_watch(static_cast<int>(handle), static_cast<int>(watch.handle));
+}
+
+auto FileWatcher::read_native_events() -> void
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+    alignas(inotify_event) std::array<std::byte, EVENT_BUFFER_SIZE> buffer;
+
+    // The descriptor is non-blocking, so this stops as soon as the queue is empty
+    for (ssize_t bytes = read(static_cast<int>(handle), buffer.data(), buffer.size()); bytes > 0;
+         bytes = read(static_cast<int>(handle), buffer.data(), buffer.size()))
+    {
+        for (ssize_t position = 0; position < bytes;)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer.data() + position);
+            position += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+            if ((event->mask & IN_Q_OVERFLOW) != 0)
+            {
+                on_overflow();
+                continue;
+            }
+
+            // Events without a name are about the watched directory itself, and only files inside it are reported
+            if (event->len == 0 || (event->mask & IN_ISDIR) != 0)
+            {
+                continue;
+            }
+
+            auto watch = std::ranges::find(watches, event->wd, [](const std::unique_ptr<Watch>& watch) -> int {
+                return static_cast<int>(watch->handle);
+            });
+            if (watch != watches.end())
+            {
+                on_event(**watch, static_cast<const char*>(event->name), to_change_type(event->mask));
+            }
+        }
+    }
+}
+
+auto FileWatcher::wait_native(std::chrono::milliseconds timeout) -> void
+{
+    pollfd descriptor{
+        .fd = static_cast<int>(handle),
+        .events = POLLIN,
+        .revents = 0,
+    };
+    ::poll(&descriptor, 1, static_cast<int>(timeout.count()));
+}
+
+} // namespace dae::io
@@ -0,0 +1,72 @@
+#include "daedalus/io/stream.h"
+
+#include "daedalus/platform/linux/io/async_read.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <string>
+#include <utility>
+
+namespace dae::io
+{
+
+auto FileStreamReader::open_native(std::string_view file_path, bool direct) -> std::optional<NativeFile>
+{
+    std::optional<FileMetaData> meta_data = get_file_meta_data(file_path);
+    if (!meta_data)
+    {
+        return std::nullopt;
+    }
+
+    std::string path(file_path);
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC | (direct ? O_DIRECT : 0)); // NOLINT
+    if (fd < 0 && direct && errno == EINVAL)
+    {
+        fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT
+    }
+    if (fd < 0)
+    {
+        return std::nullopt;
+    }
+
+    if (!direct)
+    {
+        // Reading sequentially through the page cache benefits from a larger readahead window
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+
+    return NativeFile{
+        .handle = fd,
+        .size = meta_data->size,
+        .alignment = direct ? meta_data->alignment : 1,
+        .pending_read = nullptr,
+    };
+}
+
+auto FileStreamReader::close_native(NativeFile& file) -> void
+{
+    close(static_cast<int>(file.handle));
+}
+
+auto FileStreamReader::start_read(NativeFile& file, void* buffer, uint64_t size, uint64_t offset) -> bool
+{
+    std::shared_ptr<AsyncRead> read =
+        std::make_shared<AsyncRead>(static_cast<int>(file.handle), buffer, size, offset, file.alignment);
+    AsyncReadEngine::get().submit(read);
+    file.pending_read = std::move(read);
+    return true;
+}
+
+auto FileStreamReader::finish_read(NativeFile& file) -> std::optional<uint64_t>
+{
+    std::shared_ptr<AsyncRead> read = std::static_pointer_cast<AsyncRead>(std::exchange(file.pending_read, nullptr));
+    if (!read)
+    {
+        return std::nullopt;
+    }
+    return read->wait();
+}
+
+} // namespace dae::io
@@ -0,0 +1,148 @@
+#include "daedalus/io/cache.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+
+namespace dae::io
+{
+
+namespace
+{
+constexpr uint64_t PREFETCH_READ_SIZE = static_cast<uint64_t>(1024) * 1024;
+
+/**
+ * @brief Prefetches a region of a file by mapping it and handing the view to `PrefetchVirtualMemory`, which queues
+ * large reads for it without waiting on them.
+ */
+auto prefetch_mapped(HANDLE hFile, uint64_t offset, uint64_t length) -> bool
+{
+    HANDLE hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (hMapping == NULL)
+    {
+        return false;
+    }
+
+    // Views have to start on an allocation granularity boundary
+    SYSTEM_INFO system_info{};
+    GetSystemInfo(&system_info);
+    const uint64_t view_offset = offset - (offset % system_info.dwAllocationGranularity);
+    const uint64_t view_size = length + (offset - view_offset);
+
+    void* view = MapViewOfFile(hMapping,
+                               FILE_MAP_READ,
+                               static_cast<DWORD>(view_offset >> 32),
+                               static_cast<DWORD>(view_offset),
+                               static_cast<SIZE_T>(view_size));
+    CloseHandle(hMapping);
+    if (view == NULL)
+    {
+        return false;
+    }
+
+    WIN32_MEMORY_RANGE_ENTRY range{
+        .VirtualAddress = view,
+        .NumberOfBytes = static_cast<SIZE_T>(view_size),
+    };
+    const bool success = PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0) != FALSE;
+    UnmapViewOfFile(view);
+    return success;
+}
+
+/**
+ * @brief Prefetches a region of a file by reading it through the cache and throwing the data away. Unlike
+ * `prefetch_mapped()`, this waits for the region to be read.
+ */
+auto prefetch_read(HANDLE hFile, uint64_t offset, uint64_t length) -> bool
+{
+    std::unique_ptr<char[]> scratch = std::make_unique<char[]>(PREFETCH_READ_SIZE);
+    const uint64_t end = offset + length;
+    while (offset < end)
+    {
+        OVERLAPPED overlapped{};
+        overlapped.Offset = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+        DWORD bytes_read = 0;
+        const DWORD read_size = static_cast<DWORD>(std::min(PREFETCH_READ_SIZE, end - offset));
+        if (ReadFile(hFile, scratch.get(), read_size, &bytes_read, &overlapped) == FALSE || bytes_read == 0)
+        {
+            return false;
+        }
+        offset += bytes_read;
+    }
+    return true;
+}
+} // namespace
+
+auto prefetch_file(std::string_view file_path) -> bool
+{
+    return prefetch_range(file_path, 0, UINT64_MAX);
+}
+
+auto prefetch_range(std::string_view file_path, uint64_t offset, uint64_t length) -> bool
+{
+    HANDLE hFile = CreateFileA(std::string(file_path).c_str(),
+                               GENERIC_READ,
+                               FILE_SHARE_READ,
+                               NULL,
+                               OPEN_EXISTING,
+                               FILE_ATTRIBUTE_NORMAL,
+                               NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER file_size{};
+    if (GetFileSizeEx(hFile, &file_size) == FALSE)
+    {
+        CloseHandle(hFile);
+        return false;
+    }
+
+    const uint64_t size = static_cast<uint64_t>(file_size.QuadPart);
+    offset = std::min(offset, size);
+    length = std::min(length, size - offset);
+
+    // Empty files cannot be mapped, and there is nothing to read from them anyway
+    bool success = length == 0 || prefetch_mapped(hFile, offset, length);
+    if (!success)
+    {
+        success = prefetch_read(hFile, offset, length);
+    }
+
+    CloseHandle(hFile);
+    return success;
+}
+
+auto evict_file(std::string_view file_path) -> bool
+{
+    // The cache manager purges a file's cached pages when it is opened without buffering, as long as no other handle
+    // is caching it
+    HANDLE hFile = CreateFileA(std::string(file_path).c_str(),
+                               GENERIC_READ,
+                               FILE_SHARE_READ | FILE_SHARE_WRITE,
+                               NULL,
+                               OPEN_EXISTING,
+                               FILE_FLAG_NO_BUFFERING,
+                               NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    CloseHandle(hFile);
+    return true;
+}
+
+auto get_file_residency(std::string_view /*file_path*/) -> std::optional<FileResidency>
+{
+    return std::nullopt;
+}
+
+} // namespace dae::io
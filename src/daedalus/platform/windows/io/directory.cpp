@@ -0,0 +1,119 @@
+#include "daedalus/io/directory.h"
+
+#include <algorithm>
+#include <string>
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+
+namespace dae::io
+{
+
+namespace
+{
+auto to_entry_type(DWORD attributes) -> DirectoryEntryType
+{
+    // Checked first, as links to directories also have the directory attribute
+    if ((attributes & FILE_ATTRIBUTE_REPARSE_POINT) != 0)
+    {
+        return DirectoryEntryType::Symlink;
+    }
+    if ((attributes & FILE_ATTRIBUTE_DIRECTORY) != 0)
+    {
+        return DirectoryEntryType::Directory;
+    }
+    if ((attributes & FILE_ATTRIBUTE_DEVICE) != 0)
+    {
+        return DirectoryEntryType::Other;
+    }
+    return DirectoryEntryType::File;
+}
+
+/**
+ * @brief Appends every entry of one directory to the listing, along with the size of every file.
+ *
+ * @param pattern Scratch space for the search pattern, reused between directories.
+ *
+ * @return False if the directory could not be opened.
+ */
+auto read_directory(const std::string& directory_path, std::string& pattern, DirectoryListing& listing) -> bool
+{
+    pattern.assign(directory_path);
+    if (!pattern.empty() && pattern.back() != '/' && pattern.back() != '\\')
+    {
+        pattern.push_back('/');
+    }
+    pattern.push_back('*');
+
+    // FindExInfoBasic skips looking up the short 8.3 name, and FIND_FIRST_EX_LARGE_FETCH fetches entries in larger
+    // batches per call into the filesystem
+    WIN32_FIND_DATAA find_data{};
+    HANDLE hFind = FindFirstFileExA(pattern.c_str(),
+                                    FindExInfoBasic,
+                                    &find_data,
+                                    FindExSearchNameMatch,
+                                    NULL,
+                                    FIND_FIRST_EX_LARGE_FETCH);
+    if (hFind == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    do
+    {
+        const std::string_view name(static_cast<const char*>(find_data.cFileName));
+        if (name == "." || name == "..")
+        {
+            continue;
+        }
+
+        DirectoryEntry& entry = listing.add_entry(directory_path, name, to_entry_type(find_data.dwFileAttributes));
+        if (entry.type == DirectoryEntryType::File)
+        {
+            entry.size = (static_cast<uint64_t>(find_data.nFileSizeHigh) << 32) | find_data.nFileSizeLow;
+        }
+    } while (FindNextFileA(hFind, &find_data) != FALSE);
+
+    FindClose(hFind);
+    return true;
+}
+} // namespace
+
+auto scan_directory(std::string_view directory_path, const DirectoryScanOptions& options)
+    -> std::optional<DirectoryListing>
+{
+    DirectoryListing listing;
+    std::string pattern;
+
+    std::string current_path(directory_path);
+    if (!read_directory(current_path, pattern, listing))
+    {
+        return std::nullopt;
+    }
+
+    // Subdirectories are scanned breadth first, by walking the listing as it grows. They are listed even when they are
+    // not wanted in the result, so their paths can be read back out of the arena instead of being queued separately.
+    if (options.recursive)
+    {
+        for (size_t i = 0; i < listing.entries.size(); i++)
+        {
+            if (listing.entries[i].type == DirectoryEntryType::Directory)
+            {
+                current_path.assign(listing.get_path(listing.entries[i]));
+                read_directory(current_path, pattern, listing);
+            }
+        }
+    }
+
+    if (!options.include_directories)
+    {
+        std::erase_if(listing.entries,
+                      [](const DirectoryEntry& entry) -> bool { return entry.type == DirectoryEntryType::Directory; });
+    }
+
+    // Sizes came back with the listing, so there is nothing left to fetch
+    return listing;
+}
+
+} // namespace dae::io
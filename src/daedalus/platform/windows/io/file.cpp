@@ -1,9 +1,18 @@
 #include "daedalus/io/file.h"
 
+#include "daedalus/io/checksum.h"
 #include "daedalus/math/math.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <future>
 #include <memory>
 #include <new>
+#include <string>
+#include <vector>
 
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
@@ -17,6 +26,11 @@ namespace dae::io
 
 namespace
 {
+// load_file_checked reads in chunks of this size, small enough for a chunk to still be in the CPU's cache when it is
+// checksummed. A multiple of any sector size.
+constexpr uint64_t CHECKSUM_CHUNK_SIZE = static_cast<uint64_t>(1) << 20;
+constexpr size_t CHECKSUM_READS_IN_FLIGHT = 4;
+
 /**
  * @brief Uses the Windows API to query a file HANDLE for a file's logical disk alignment, to be used for allocating
  * user-buffers for uncached IO access.
@@ -46,6 +60,29 @@ auto get_alignment_from_file(HANDLE hFile) -> std::optional<size_t>
     return file_storage_info.PhysicalBytesPerSectorForPerformance;
 }
 
+/**
+ * @brief Uses the Windows API to query a file HANDLE for when the file was last written to.
+ *
+ * @param hFile The file to query.
+ *
+ * @return The modification time in nanoseconds since the Unix epoch, if it can be retreived.
+ */
+auto get_modified_time_from_file(HANDLE hFile) -> std::optional<int64_t>
+{
+    FILETIME write_time{};
+    if (GetFileTime(hFile, NULL, NULL, &write_time) == FALSE)
+    {
+        return std::nullopt;
+    }
+
+    // FILETIME counts 100 nanosecond intervals since 1601-01-01
+    constexpr int64_t UNIX_EPOCH_AS_FILETIME = 116444736000000000;
+    ULARGE_INTEGER intervals{};
+    intervals.LowPart = write_time.dwLowDateTime;
+    intervals.HighPart = write_time.dwHighDateTime;
+    return (static_cast<int64_t>(intervals.QuadPart) - UNIX_EPOCH_AS_FILETIME) * 100;
+}
+
 /**
  * @brief Uses the Windows API to query a file HANDLE for a file's size on disk to load.
  *
@@ -75,14 +112,408 @@ auto get_size_from_file(HANDLE hFile) -> std::optional<size_t>
     return file_standard_info.AllocationSize.QuadPart;
 }
 
+/**
+ * @brief A FileFuture::State for a single overlapped ReadFile of a whole file.
+ */
+class OverlappedLoadState final : public FileFuture::State
+{
+  public:
+    /**
+     * @param length The most file data the File can hold, when the read was widened out to alignment boundaries.
+     */
+    OverlappedLoadState(HANDLE hFile, std::unique_ptr<OVERLAPPED> overlapped, File file, uint64_t length = UINT64_MAX)
+        : hFile(hFile), overlapped(std::move(overlapped)), file(file), length(length)
+    {
+    }
+
+    auto is_ready() -> bool override
+    {
+        return HasOverlappedIoCompleted(overlapped.get());
+    }
+
+    auto wait_for(std::chrono::nanoseconds timeout) -> bool override
+    {
+        // INFINITE is reserved, so long timeouts are clamped just short of it
+        const int64_t milliseconds = std::clamp<int64_t>(
+            std::chrono::ceil<std::chrono::milliseconds>(timeout).count(), 0, static_cast<int64_t>(INFINITE - 1));
+        return WaitForSingleObject(overlapped->hEvent, static_cast<DWORD>(milliseconds)) == WAIT_OBJECT_0;
+    }
+
+    auto cancel() -> bool override
+    {
+        return CancelIoEx(hFile, overlapped.get()) != FALSE;
+    }
+
+    auto bytes_transferred() const -> uint64_t override
+    {
+        // A single ReadFile only reports how much it read once it is complete
+        return HasOverlappedIoCompleted(overlapped.get()) ? overlapped->InternalHigh : 0;
+    }
+
+    auto bytes_total() const -> uint64_t override
+    {
+        return file.buffer_size;
+    }
+
+    auto get() -> std::optional<File> override
+    {
+        DWORD bytes_read = 0;
+        BOOL success = GetOverlappedResult(hFile, overlapped.get(), &bytes_read, TRUE);
+
+        CloseHandle(overlapped->hEvent);
+        CloseHandle(hFile);
+
+        if (success == FALSE)
+        {
+            free_file(file);
+            return std::nullopt;
+        }
+
+        file.bytes_read = std::min<uint64_t>(bytes_read > file.data_offset ? bytes_read - file.data_offset : 0, length);
+        return file;
+    }
+
+  private:
+    HANDLE hFile;
+    std::unique_ptr<OVERLAPPED> overlapped;
+    File file;
+    uint64_t length;
+};
+
+/**
+ * @brief A buffer allocated for one region of a file, not read yet.
+ */
+struct RangeLoad
+{
+    File file{};
+    /**
+     * @brief The offset in the file that the start of the buffer is read from.
+     */
+    uint64_t read_offset{0};
+    /**
+     * @brief The length of the requested region, cut short at the end of the file.
+     */
+    uint64_t length{0};
+};
+
+/**
+ * @brief Opens a file for range reads, and gets its logical size and alignment.
+ *
+ * @param file The path to the file.
+ * @param direct Whether to bypass the filesystem cache with `FILE_FLAG_NO_BUFFERING`.
+ * @param overlapped Whether to open the file for overlapped reads.
+ * @param meta_data Filled in with the file's size and alignment.
+ *
+ * @return The file HANDLE, or INVALID_HANDLE_VALUE on failure.
+ */
+auto open_for_range(std::string_view file, bool direct, bool overlapped, FileMetaData& meta_data) -> HANDLE
+{
+    HANDLE hFile = CreateFileA(std::string(file).c_str(),
+                               GENERIC_READ,
+                               FILE_SHARE_READ,
+                               NULL,
+                               OPEN_EXISTING,
+                               (overlapped ? FILE_FLAG_OVERLAPPED : 0) |
+                                   (direct ? FILE_FLAG_NO_BUFFERING : FILE_ATTRIBUTE_NORMAL),
+                               NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return INVALID_HANDLE_VALUE;
+    }
+
+    // The logical end of the file, rather than its allocation size on disk
+    LARGE_INTEGER file_size{};
+    std::optional<size_t> maybe_file_alignment = direct ? get_alignment_from_file(hFile) : 1;
+    if (GetFileSizeEx(hFile, &file_size) == FALSE || !maybe_file_alignment)
+    {
+        CloseHandle(hFile);
+        return INVALID_HANDLE_VALUE;
+    }
+
+    meta_data = FileMetaData{
+        .size = static_cast<uint64_t>(file_size.QuadPart),
+        .alignment = maybe_file_alignment.value(),
+    };
+    return hFile;
+}
+
+/**
+ * @brief Allocates a buffer for reading one region of a file, widened out to the file's alignment.
+ *
+ * @param meta_data The file's size and alignment.
+ * @param offset The offset of the region in the file.
+ * @param length The length of the region. Cut short at the end of the file.
+ *
+ * @return The RangeLoad for the region.
+ */
+auto prepare_range(const FileMetaData& meta_data, uint64_t offset, uint64_t length) -> RangeLoad
+{
+    offset = std::min(offset, meta_data.size);
+    length = std::min(length, meta_data.size - offset);
+
+    // With NO_BUFFERING, the offset and size of every read have to be multiples of the alignment.
+    const uint64_t read_offset = dae::align_down(offset, meta_data.alignment);
+    const uint64_t read_end = dae::align_up(offset + length, meta_data.alignment);
+
+    File f = allocate_file(read_end - read_offset, meta_data.alignment, nullptr);
+    f.data_offset = offset - read_offset;
+    return RangeLoad{
+        .file = f,
+        .read_offset = read_offset,
+        .length = length,
+    };
+}
+
+/**
+ * @brief Issues the overlapped read for a RangeLoad.
+ *
+ * @return Whether the read was issued.
+ */
+auto start_range_read(HANDLE hFile, RangeLoad& range, OVERLAPPED& overlapped) -> bool
+{
+    overlapped.Offset = static_cast<DWORD>(range.read_offset);
+    overlapped.OffsetHigh = static_cast<DWORD>(range.read_offset >> 32);
+
+    BOOL result = ReadFile(hFile, range.file.buffer, static_cast<DWORD>(range.file.buffer_size), NULL, &overlapped);
+    return result != FALSE || GetLastError() == ERROR_IO_PENDING;
+}
+
+/**
+ * @brief Collects the result of a read issued with start_range_read, blocking until it is complete.
+ *
+ * @return The File if the read succeeded. On failure the buffer is freed.
+ */
+auto finish_range_read(HANDLE hFile, RangeLoad& range, OVERLAPPED& overlapped) -> std::optional<File>
+{
+    DWORD bytes_read = 0;
+    if (GetOverlappedResult(hFile, &overlapped, &bytes_read, TRUE) == FALSE && GetLastError() != ERROR_HANDLE_EOF)
+    {
+        free_file(range.file);
+        return std::nullopt;
+    }
+
+    const uint64_t data_bytes = bytes_read > range.file.data_offset ? bytes_read - range.file.data_offset : 0;
+    range.file.bytes_read = std::min(data_bytes, range.length);
+    return range.file;
+}
+
+/**
+ * @brief One chunk of a checksummed load, read with its own OVERLAPPED.
+ */
+struct ChunkRead
+{
+    OVERLAPPED overlapped{};
+    uint64_t offset{0};
+    DWORD size{0};
+    bool in_flight{false};
+};
+
+/**
+ * @brief Reads a whole file in chunks with overlapped reads, checksumming each chunk as soon as it arrives while the
+ * following chunks are still being read.
+ *
+ * @param file The path to the file.
+ * @param direct Whether to bypass the filesystem cache with `FILE_FLAG_NO_BUFFERING`.
+ * @param crc Set to the CRC32C of the file data.
+ *
+ * @return The File if the read succeeds.
+ */
+auto load_file_checked_overlapped(std::string_view file, bool direct, uint32_t& crc) -> std::optional<File>
+{
+    FileMetaData meta_data{};
+    HANDLE hFile = open_for_range(file, direct, true, meta_data);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return std::nullopt;
+    }
+
+    RangeLoad range = prepare_range(meta_data, 0, meta_data.size);
+    File& f = range.file;
+    auto* buffer = static_cast<std::byte*>(f.buffer);
+    const uint64_t chunk_size = dae::align_up(CHECKSUM_CHUNK_SIZE, f.alignment);
+
+    // Chunks are issued and retired in the same order, cycling through the slots, so the oldest read is always the
+    // next slot along
+    std::array<ChunkRead, CHECKSUM_READS_IN_FLIGHT> chunks{};
+    bool failed = false;
+    for (ChunkRead& chunk : chunks)
+    {
+        chunk.overlapped.hEvent = CreateEvent(NULL,  // Security Attributes
+                                              TRUE,  // Manual Reset required
+                                              FALSE, // Start signaled
+                                              NULL); // Name
+        failed = failed || chunk.overlapped.hEvent == NULL;
+    }
+
+    uint64_t next_offset = 0;
+    auto issue_read = [&](ChunkRead& chunk) -> bool {
+        chunk.offset = next_offset;
+        chunk.size = static_cast<DWORD>(std::min(chunk_size, f.buffer_size - next_offset));
+        next_offset += chunk.size;
+
+        ResetEvent(chunk.overlapped.hEvent);
+        chunk.overlapped.Offset = static_cast<DWORD>(range.read_offset + chunk.offset);
+        chunk.overlapped.OffsetHigh = static_cast<DWORD>((range.read_offset + chunk.offset) >> 32);
+        BOOL result = ReadFile(hFile, buffer + chunk.offset, chunk.size, NULL, &chunk.overlapped); // NOLINT
+        chunk.in_flight = result != FALSE || GetLastError() == ERROR_IO_PENDING;
+        return chunk.in_flight;
+    };
+
+    for (ChunkRead& chunk : chunks)
+    {
+        if (failed || next_offset >= f.buffer_size)
+        {
+            break;
+        }
+        failed = !issue_read(chunk);
+    }
+
+    crc = 0;
+    uint64_t bytes_read = 0;
+    bool at_end = false;
+    for (size_t i = 0; chunks[i].in_flight; i = (i + 1) % chunks.size())
+    {
+        // Every read has to finish before the buffer can be freed, even once the load has failed
+        ChunkRead& chunk = chunks[i];
+        chunk.in_flight = false;
+        DWORD chunk_read = 0;
+        if (GetOverlappedResult(hFile, &chunk.overlapped, &chunk_read, TRUE) == FALSE &&
+            GetLastError() != ERROR_HANDLE_EOF)
+        {
+            failed = true;
+        }
+        if (failed || at_end)
+        {
+            continue;
+        }
+
+        // Anything past the length the file had when it was opened is not part of the load
+        const uint64_t chunk_bytes =
+            std::min<uint64_t>(chunk_read, range.length - std::min(chunk.offset, range.length));
+        crc = crc32c(std::span<const std::byte>(buffer + chunk.offset, chunk_bytes), crc); // NOLINT
+        bytes_read += chunk_read;
+
+        // A short read means the end of the file was reached, and later chunks have nothing to read
+        at_end = chunk_read < chunk.size;
+        if (!at_end && next_offset < f.buffer_size)
+        {
+            failed = !issue_read(chunk);
+        }
+    }
+
+    for (ChunkRead& chunk : chunks)
+    {
+        if (chunk.overlapped.hEvent != NULL)
+        {
+            CloseHandle(chunk.overlapped.hEvent);
+        }
+    }
+    CloseHandle(hFile);
+
+    if (failed)
+    {
+        free_file(f);
+        return std::nullopt;
+    }
+
+    f.bytes_read = std::min(bytes_read > f.data_offset ? bytes_read - f.data_offset : 0, range.length);
+    return f;
+}
+
+/**
+ * @brief Reads one region of a file opened with the standard library.
+ *
+ * @param f The open file.
+ * @param file_size The size of the file.
+ * @param offset The offset of the region in the file.
+ * @param length The length of the region. Cut short at the end of the file.
+ *
+ * @return A File struct if successful.
+ */
+auto load_range_standard_library(std::ifstream& f, uint64_t file_size, uint64_t offset, uint64_t length)
+    -> std::optional<File>
+{
+    offset = std::min(offset, file_size);
+    length = std::min(length, file_size - offset);
+
+    File file_data = allocate_file(length, 1, nullptr);
+
+    f.clear();
+    f.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+    if (!f.read(static_cast<char*>(file_data.buffer), static_cast<std::streamsize>(length)))
+    {
+        free_file(file_data);
+        return std::nullopt;
+    }
+
+    file_data.bytes_read = length;
+    return file_data;
+}
+
+/**
+ * @brief Maps one region of a file read-only.
+ *
+ * @param hMapping The file mapping object. The view keeps its own reference to it.
+ * @param meta_data The file's size.
+ * @param offset The offset of the region in the file.
+ * @param length The length of the region. Cut short at the end of the file.
+ *
+ * @return A File struct whose buffer is the view if successful. Empty regions cannot be mapped and will fail.
+ */
+auto map_range(HANDLE hMapping, const FileMetaData& meta_data, uint64_t offset, uint64_t length) -> std::optional<File>
+{
+    offset = std::min(offset, meta_data.size);
+    length = std::min(length, meta_data.size - offset);
+
+    // MapViewOfFile would map the whole file for a zero length, so an empty region is an empty File like with the
+    // other strategies
+    SYSTEM_INFO system_info{};
+    GetSystemInfo(&system_info);
+    const uint64_t granularity = system_info.dwAllocationGranularity;
+    if (length == 0)
+    {
+        return File{
+            .buffer = nullptr,
+            .buffer_size = 0,
+            .bytes_read = 0,
+            .alignment = granularity,
+            .allocation_type = AllocationType::Mapped,
+        };
+    }
+
+    // Views have to start on an allocation granularity boundary
+    const uint64_t map_offset = dae::align_down(offset, granularity);
+    const uint64_t map_length = offset + length - map_offset;
+
+    void* view = MapViewOfFile(hMapping,
+                               FILE_MAP_READ,
+                               static_cast<DWORD>(map_offset >> 32),
+                               static_cast<DWORD>(map_offset),
+                               static_cast<SIZE_T>(map_length));
+    if (view == NULL)
+    {
+        return std::nullopt;
+    }
+
+    return File{
+        .buffer = view,
+        .buffer_size = map_length,
+        .bytes_read = length,
+        .alignment = granularity,
+        .allocation_type = AllocationType::Mapped,
+        .data_offset = offset - map_offset,
+    };
+}
+
 /**
  * @brief An implementation of load_file for FileLoadStrategy::StdLibrary
  *
  * @param file The path to the file.
+ * @param pool If set, the pool to draw the buffer from.
  *
  * @return A File struct if successful.
  */
-auto load_file_standard_library(std::string_view file) -> std::optional<File>
+auto load_file_standard_library(std::string_view file, FileBufferPool* pool) -> std::optional<File>
 {
     // Open file
     std::ifstream f(std::string(file), std::ios::binary | std::ios::ate);
@@ -94,44 +525,43 @@ auto load_file_standard_library(std::string_view file) -> std::optional<File>
     if (size <= 0)
         return std::nullopt;
 
-    void* buffer = ::operator new(size);
+    File file_data = allocate_file(static_cast<uint64_t>(size), 1, pool);
 
     f.seekg(0, std::ios::beg);
-    if (!f.read(static_cast<char*>(buffer), size))
+    if (!f.read(static_cast<char*>(file_data.buffer), size))
     {
+        free_file(file_data);
         return std::nullopt;
     }
 
-    return File{
-        .buffer = buffer,
-        .buffer_size = static_cast<size_t>(size),
-        .bytes_read = static_cast<size_t>(size),
-        .alignment = 1,
-        .allocation_type = AllocationType::Unaligned,
-    };
+    file_data.bytes_read = static_cast<uint64_t>(size);
+    return file_data;
 }
 
 /**
  * @brief An implementation of load_file_async for FileLoadStrategy::StdLibrary
  *
  * @param file The path to the file.
+ * @param pool If set, the pool to draw the buffer from.
  *
- * @return A callable that will optionally return a File struct if it succeeds.
+ * @return A FileFuture that will optionally return a File struct if it succeeds.
  */
-auto load_file_standard_library_async(std::string_view file)
-    -> std::optional<std::move_only_function<std::optional<File>()>>
+auto load_file_standard_library_async(std::string_view file, FileBufferPool* pool)
+    -> std::optional<FileFuture>
 {
-    return [file = std::string(file)]() -> std::optional<File> { return load_file_standard_library(file); };
+    return FileFuture::from_future(
+        std::async(std::launch::async, load_file_standard_library, std::string(file), pool));
 }
 
 /**
  * @brief An implementation of load_file for FileLoadStrategy::AllowCached
  *
  * @param file The path to the file.
+ * @param pool If set, the pool to draw the buffer from.
  *
  * @return A File struct if successful.
  */
-auto load_file_allow_cached(std::string_view file) -> std::optional<File>
+auto load_file_allow_cached(std::string_view file, FileBufferPool* pool) -> std::optional<File>
 {
     HANDLE hFile = CreateFileA(file.data(), // NOLINT(bugprone-suspicious-stringview-data-usage)
                                GENERIC_READ,
@@ -153,13 +583,7 @@ auto load_file_allow_cached(std::string_view file) -> std::optional<File>
     }
     size_t file_size = maybe_file_size.value();
 
-    File f{
-        .buffer = ::operator new(file_size),
-        .buffer_size = file_size,
-        .bytes_read = 0,
-        .alignment = 1,
-        .allocation_type = AllocationType::Unaligned,
-    };
+    File f = allocate_file(file_size, 1, pool);
 
     DWORD bytes_read = 0;
     BOOL result = ReadFile(hFile, f.buffer, static_cast<DWORD>(file_size), &bytes_read, NULL); // NOLINT
@@ -181,11 +605,12 @@ auto load_file_allow_cached(std::string_view file) -> std::optional<File>
  * @brief An implementation of load_file_async for FileLoadStrategy::AllowCached
  *
  * @param file The path to the file.
+ * @param pool If set, the pool to draw the buffer from.
  *
- * @return A callable that will optionally return a File struct if it succeeds.
+ * @return A FileFuture that will optionally return a File struct if it succeeds.
  */
-auto load_file_allow_cached_async(std::string_view file)
-    -> std::optional<std::move_only_function<std::optional<File>()>>
+auto load_file_allow_cached_async(std::string_view file, FileBufferPool* pool)
+    -> std::optional<FileFuture>
 {
     HANDLE hFile = CreateFileA(file.data(), // NOLINT(bugprone-suspicious-stringview-data-usage)
                                GENERIC_READ,
@@ -207,12 +632,7 @@ auto load_file_allow_cached_async(std::string_view file)
     }
     size_t file_size = maybe_file_size.value();
 
-    File f{
-        .buffer = ::operator new(file_size),
-        .buffer_size = file_size,
-        .alignment = 1,
-        .allocation_type = AllocationType::Unaligned,
-    };
+    File f = allocate_file(file_size, 1, pool);
 
     std::unique_ptr<OVERLAPPED> overlapped = std::make_unique<OVERLAPPED>();
     overlapped->hEvent = CreateEvent(NULL,  // Security Attributes
@@ -230,34 +650,18 @@ auto load_file_allow_cached_async(std::string_view file)
         return std::nullopt;
     }
 
-    return [overlapped = std::move(overlapped), hFile, f, file_size]() mutable -> std::optional<File> {
-        DWORD bytes_read = 0;
-        BOOL success = GetOverlappedResult(hFile, overlapped.get(), &bytes_read, TRUE);
-
-        CloseHandle(overlapped->hEvent);
-        CloseHandle(hFile);
-
-        if (success)
-        {
-            f.bytes_read = bytes_read;
-            return f;
-        }
-        else
-        {
-            free_file(f);
-            return std::nullopt;
-        }
-    };
+    return FileFuture(std::make_unique<OverlappedLoadState>(hFile, std::move(overlapped), f));
 }
 
 /**
  * @brief An implementation of load_file for FileLoadStrategy::SafeDirectDisk
  *
  * @param file The path to the file.
+ * @param pool If set, the pool to draw the buffer from.
  *
  * @return A File struct if successful.
  */
-auto load_file_safe_direct_disk(std::string_view file) -> std::optional<File>
+auto load_file_safe_direct_disk(std::string_view file, FileBufferPool* pool) -> std::optional<File>
 {
     HANDLE hFile = CreateFileA(file.data(), // NOLINT(bugprone-suspicious-stringview-data-usage)
                                GENERIC_READ,
@@ -272,7 +676,7 @@ auto load_file_safe_direct_disk(std::string_view file) -> std::optional<File>
     }
 
     std::optional<size_t> maybe_file_size = get_size_from_file(hFile);
-    std::optional<size_t> maybe_file_alignment = get_size_from_file(hFile);
+    std::optional<size_t> maybe_file_alignment = get_alignment_from_file(hFile);
     if (!maybe_file_size || !maybe_file_alignment)
     {
         CloseHandle(hFile);
@@ -284,12 +688,7 @@ auto load_file_safe_direct_disk(std::string_view file) -> std::optional<File>
     // When NO_BUFFERING is specified, file size to work with has to be a multiple of the alignment.
     file_size = dae::align_up(file_size, file_alignment);
 
-    File f{
-        .buffer = ::operator new(file_size, std::align_val_t(file_alignment)),
-        .buffer_size = file_size,
-        .alignment = file_alignment,
-        .allocation_type = AllocationType::Aligned,
-    };
+    File f = allocate_file(file_size, file_alignment, pool);
 
     DWORD bytes_read = 0;
     BOOL result = ReadFile(hFile, f.buffer, static_cast<DWORD>(file_size), &bytes_read, NULL); // NOLINT
@@ -311,11 +710,12 @@ auto load_file_safe_direct_disk(std::string_view file) -> std::optional<File>
  * @brief An implementation of load_file_async for FileLoadStrategy::SafeDirectDisk
  *
  * @param file The path to the file.
+ * @param pool If set, the pool to draw the buffer from.
  *
- * @return A callable that will optionally return a File struct if it succeeds.
+ * @return A FileFuture that will optionally return a File struct if it succeeds.
  */
-auto load_file_safe_direct_disk_async(std::string_view file)
-    -> std::optional<std::move_only_function<std::optional<File>()>>
+auto load_file_safe_direct_disk_async(std::string_view file, FileBufferPool* pool)
+    -> std::optional<FileFuture>
 {
     HANDLE hFile = CreateFileA(file.data(), // NOLINT(bugprone-suspicious-stringview-data-usage)
                                GENERIC_READ,
@@ -330,7 +730,7 @@ auto load_file_safe_direct_disk_async(std::string_view file)
     }
 
     std::optional<size_t> maybe_file_size = get_size_from_file(hFile);
-    std::optional<size_t> maybe_file_alignment = get_size_from_file(hFile);
+    std::optional<size_t> maybe_file_alignment = get_alignment_from_file(hFile);
     if (!maybe_file_size || !maybe_file_alignment)
     {
         CloseHandle(hFile);
@@ -342,12 +742,7 @@ auto load_file_safe_direct_disk_async(std::string_view file)
     // When NO_BUFFERING is specified, file size to work with has to be a multiple of the alignment.
     file_size = dae::align_up(file_size, file_alignment);
 
-    File f{
-        .buffer = ::operator new(file_size, std::align_val_t(file_alignment)),
-        .buffer_size = file_size,
-        .alignment = file_alignment,
-        .allocation_type = AllocationType::Aligned,
-    };
+    File f = allocate_file(file_size, file_alignment, pool);
 
     std::unique_ptr<OVERLAPPED> overlapped = std::make_unique<OVERLAPPED>();
     overlapped->hEvent = CreateEvent(NULL,  // Security Attributes
@@ -365,57 +760,892 @@ auto load_file_safe_direct_disk_async(std::string_view file)
         return std::nullopt;
     }
 
-    return [overlapped = std::move(overlapped), hFile, f, file_size]() mutable -> std::optional<File> {
-        DWORD bytes_read = 0;
-        BOOL success = GetOverlappedResult(hFile, overlapped.get(), &bytes_read, TRUE);
-
-        CloseHandle(overlapped->hEvent);
-        CloseHandle(hFile);
-
-        if (success)
-        {
-            f.bytes_read = bytes_read;
-            return f;
-        }
-        else
-        {
-            free_file(f);
-            return std::nullopt;
-        }
-    };
+    return FileFuture(std::make_unique<OverlappedLoadState>(hFile, std::move(overlapped), f));
 }
 
-} // namespace
-
-auto load_file(std::string_view file, FileLoadStrategy load_strategy) -> std::optional<File>
+/**
+ * @brief An implementation of load_file_async for FileLoadStrategy::Mapped
+ *
+ * @note Creating the mapping does not read the file, so the mapping is created up front and the FileFuture is ready
+ * immediately.
+ *
+ * @param file The path to the file.
+ *
+ * @return A FileFuture that will optionally return a File struct if it succeeds.
+ */
+auto load_file_mapped_async(std::string_view file) -> std::optional<FileFuture>
 {
-    switch (load_strategy)
+    std::optional<File> f = load_file_mapped(file, MappedLoadHint::Lazy);
+    if (!f)
     {
-    case FileLoadStrategy::StdLibrary:
-        return load_file_standard_library(file);
-    case FileLoadStrategy::AllowCached:
-        return load_file_allow_cached(file);
-    case FileLoadStrategy::SafeDirectDisk:
-        return load_file_safe_direct_disk(file);
-    default:
         return std::nullopt;
     }
+    return FileFuture::from_result(f);
 }
 
-auto load_file_async(std::string_view file, FileLoadStrategy load_strategy)
-    -> std::optional<std::move_only_function<std::optional<File>()>>
+/**
+ * @brief A file that is being written, but has not been closed and moved into place yet.
+ */
+struct PendingSave
 {
-    switch (load_strategy)
+    HANDLE hFile{INVALID_HANDLE_VALUE};
+    bool direct{false};
+    std::string write_path;
+    std::string final_path;
+};
+
+/**
+ * @brief Builds a unique path in the same directory as a file, to write to before moving over the file.
+ *
+ * @param file_path The path to the destination file.
+ *
+ * @return A path that no other save in any process will pick.
+ */
+auto make_temporary_path(std::string_view file_path) -> std::string
+{
+    static std::atomic<uint64_t> counter{0};
+    return std::string(file_path) + ".tmp." + std::to_string(GetCurrentProcessId()) + "." +
+           std::to_string(counter.fetch_add(1, std::memory_order_relaxed));
+}
+
+/**
+ * @brief Opens the file a save should write to, which is a temporary file when replacing atomically.
+ *
+ * @param file The path to the destination file.
+ * @param options The settings for the save.
+ *
+ * @return A PendingSave if the file could be opened.
+ */
+auto open_for_save(std::string_view file, const FileSaveOptions& options) -> std::optional<PendingSave>
+{
+    PendingSave pending{
+        .direct = options.save_strategy == FileLoadStrategy::SafeDirectDisk,
+        .write_path = options.atomic_replace ? make_temporary_path(file) : std::string(file),
+        .final_path = std::string(file),
+    };
+
+    pending.hFile = CreateFileA(pending.write_path.c_str(),
+                                GENERIC_WRITE,
+                                0,
+                                NULL,
+                                options.atomic_replace ? CREATE_NEW : CREATE_ALWAYS,
+                                pending.direct ? FILE_FLAG_NO_BUFFERING : FILE_ATTRIBUTE_NORMAL,
+                                NULL);
+    if (pending.hFile == INVALID_HANDLE_VALUE)
     {
-    case FileLoadStrategy::StdLibrary:
-        return load_file_standard_library_async(file);
-    case FileLoadStrategy::AllowCached:
-        return load_file_allow_cached_async(file);
-    case FileLoadStrategy::SafeDirectDisk:
-        return load_file_safe_direct_disk_async(file);
-    default:
         return std::nullopt;
     }
+
+    return pending;
+}
+
+/**
+ * @brief Writes a buffer to the current position of a file until the whole buffer is written.
+ *
+ * @return True if every byte was written.
+ */
+auto write_fully(HANDLE hFile, const void* buffer, size_t size) -> bool
+{
+    constexpr size_t MAX_WRITE_SIZE = size_t{1} << 30;
+
+    size_t total = 0;
+    while (total < size)
+    {
+        DWORD written = 0;
+        BOOL result = WriteFile(hFile,
+                                static_cast<const char*>(buffer) + total, // NOLINT
+                                static_cast<DWORD>(std::min(size - total, MAX_WRITE_SIZE)),
+                                &written,
+                                NULL);
+        if (result == FALSE)
+        {
+            return false;
+        }
+        total += written;
+    }
+    return true;
+}
+
+/**
+ * @brief Writes a buffer to a file opened with `FILE_FLAG_NO_BUFFERING`, where every write must be aligned in memory
+ * and in size.
+ *
+ * @note If the buffer is aligned, everything but the final partial sector is written straight from it. Otherwise the
+ * data is copied through an aligned staging buffer. The final partial sector is padded out to a whole sector, and the
+ * padding is cut off afterwards by moving the end of the file.
+ *
+ * @return True if every byte was written.
+ */
+auto write_direct(HANDLE hFile, std::span<const std::byte> data, size_t alignment) -> bool
+{
+    constexpr size_t STAGING_SIZE = static_cast<size_t>(1024) * 1024;
+
+    const bool buffer_aligned = reinterpret_cast<uintptr_t>(data.data()) % alignment == 0; // NOLINT
+    const size_t whole_sectors_size = data.size() - (data.size() % alignment);
+    const size_t staging_size = buffer_aligned ? alignment : dae::align_up(STAGING_SIZE, alignment);
+
+    std::byte* staging = static_cast<std::byte*>(::operator new(staging_size, std::align_val_t(alignment)));
+
+    bool success = true;
+    size_t written = 0;
+    if (buffer_aligned)
+    {
+        success = write_fully(hFile, data.data(), whole_sectors_size);
+        written = whole_sectors_size;
+    }
+
+    while (success && written < data.size())
+    {
+        const size_t size = std::min(staging_size, data.size() - written);
+        const size_t padded_size = dae::align_up(size, alignment);
+        std::memcpy(staging, data.data() + written, size);   // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memset(staging + size, 0, padded_size - size); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        success = write_fully(hFile, staging, padded_size);
+        written += size;
+    }
+
+    ::operator delete(staging, std::align_val_t(alignment));
+
+    FILE_END_OF_FILE_INFO end_of_file{};
+    end_of_file.EndOfFile.QuadPart = static_cast<LONGLONG>(data.size());
+    return success &&
+           SetFileInformationByHandle(hFile, FileEndOfFileInfo, &end_of_file, sizeof(FILE_END_OF_FILE_INFO)) != FALSE;
+}
+
+/**
+ * @brief Writes the contents of a save.
+ *
+ * @return True if every byte was written.
+ */
+auto write_save(const PendingSave& pending, std::span<const std::byte> data) -> bool
+{
+    if (!pending.direct)
+    {
+        return write_fully(pending.hFile, data.data(), data.size());
+    }
+
+    std::optional<size_t> alignment = get_alignment_from_file(pending.hFile);
+    if (!alignment)
+    {
+        return false;
+    }
+    return write_direct(pending.hFile, data, alignment.value());
+}
+
+/**
+ * @brief Flushes a written file as far as the sync mode asks for. Windows has no data-only flush, so both modes flush
+ * everything.
+ *
+ * @return True if the flush succeeded.
+ */
+auto sync_save(HANDLE hFile, FileSyncMode sync_mode) -> bool
+{
+    if (sync_mode == FileSyncMode::None)
+    {
+        return true;
+    }
+    return FlushFileBuffers(hFile) != FALSE;
+}
+
+/**
+ * @brief Moves a written temporary file over its destination.
+ *
+ * @note An existing destination is swapped out with `ReplaceFile`, which carries its ACL, attributes and owner over to
+ * the new file, so an atomic replace does not reset them to the defaults for a new file. The temporary file's data has
+ * already been flushed if a sync was asked for.
+ *
+ * @return True if the move succeeded.
+ */
+auto replace_file(const std::string& write_path, const std::string& final_path, FileSyncMode sync_mode) -> bool
+{
+    if (ReplaceFileA(final_path.c_str(), write_path.c_str(), NULL, REPLACEFILE_IGNORE_MERGE_ERRORS, NULL, NULL) !=
+        FALSE)
+    {
+        return true;
+    }
+
+    // There is nothing to replace yet, so the temporary file is simply moved into place
+    DWORD flags = MOVEFILE_REPLACE_EXISTING | (sync_mode != FileSyncMode::None ? MOVEFILE_WRITE_THROUGH : 0);
+    if (GetLastError() == ERROR_FILE_NOT_FOUND && MoveFileExA(write_path.c_str(), final_path.c_str(), flags) != FALSE)
+    {
+        return true;
+    }
+
+    DeleteFileA(write_path.c_str());
+    return false;
+}
+
+/**
+ * @brief Closes a written file and, when replacing atomically, moves it over the destination. On failure, any
+ * temporary file is removed.
+ *
+ * @param pending The save to finish.
+ * @param success Whether the save has succeeded so far.
+ * @param options The settings for the save.
+ *
+ * @return True if the save succeeded.
+ */
+auto finish_save(PendingSave& pending, bool success, const FileSaveOptions& options) -> bool
+{
+    success = CloseHandle(pending.hFile) != FALSE && success;
+    pending.hFile = INVALID_HANDLE_VALUE;
+
+    if (!options.atomic_replace)
+    {
+        return success;
+    }
+
+    if (!success)
+    {
+        DeleteFileA(pending.write_path.c_str());
+        return false;
+    }
+    return replace_file(pending.write_path, pending.final_path, options.sync_mode);
+}
+
+/**
+ * @brief An implementation of save_file for FileLoadStrategy::StdLibrary
+ *
+ * @note std::ofstream cannot flush to disk, so a requested sync reopens the file to flush it.
+ */
+auto save_file_standard_library(std::string_view file, std::span<const std::byte> data, const FileSaveOptions& options)
+    -> bool
+{
+    std::string write_path = options.atomic_replace ? make_temporary_path(file) : std::string(file);
+
+    std::ofstream f(write_path, std::ios::binary | std::ios::trunc);
+    if (!f.is_open())
+        return false;
+
+    f.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())); // NOLINT
+    f.close();
+    bool success = !f.fail();
+
+    if (success && options.sync_mode != FileSyncMode::None)
+    {
+        HANDLE hFile =
+            CreateFileA(write_path.c_str(), GENERIC_WRITE, 0, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        success = hFile != INVALID_HANDLE_VALUE && sync_save(hFile, options.sync_mode);
+        if (hFile != INVALID_HANDLE_VALUE)
+            CloseHandle(hFile);
+    }
+
+    if (!options.atomic_replace)
+    {
+        return success;
+    }
+
+    if (!success)
+    {
+        DeleteFileA(write_path.c_str());
+        return false;
+    }
+    return replace_file(write_path, std::string(file), options.sync_mode);
+}
+
+} // namespace
+
+namespace
+{
+/**
+ * @brief Dispatches load_file to the implementation for a strategy.
+ */
+auto load_file_with_strategy(std::string_view file, FileLoadStrategy load_strategy, FileBufferPool* pool)
+    -> std::optional<File>
+{
+    switch (load_strategy)
+    {
+    case FileLoadStrategy::StdLibrary:
+        return load_file_standard_library(file, pool);
+    case FileLoadStrategy::AllowCached:
+        return load_file_allow_cached(file, pool);
+    case FileLoadStrategy::SafeDirectDisk:
+        return load_file_safe_direct_disk(file, pool);
+    case FileLoadStrategy::Mapped:
+        return load_file_mapped(file, MappedLoadHint::Lazy);
+    default:
+        return std::nullopt;
+    }
+}
+} // namespace
+
+auto load_file(std::string_view file, FileLoadStrategy load_strategy) -> std::optional<File>
+{
+    return load_file_with_strategy(file, load_strategy, nullptr);
+}
+
+auto load_file(std::string_view file, FileLoadStrategy load_strategy, FileBufferPool& pool) -> std::optional<File>
+{
+    return load_file_with_strategy(file, load_strategy, &pool);
+}
+
+auto load_file_mapped(std::string_view file, MappedLoadHint hint) -> std::optional<File>
+{
+    HANDLE hFile = CreateFileA(file.data(), // NOLINT(bugprone-suspicious-stringview-data-usage)
+                               GENERIC_READ,
+                               FILE_SHARE_READ,
+                               NULL,
+                               OPEN_EXISTING,
+                               hint == MappedLoadHint::Sequential ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_ATTRIBUTE_NORMAL,
+                               NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return std::nullopt;
+    }
+
+    // The mapping covers the logical end of the file, not the allocation size on disk
+    LARGE_INTEGER file_size{};
+    if (GetFileSizeEx(hFile, &file_size) == FALSE)
+    {
+        CloseHandle(hFile);
+        return std::nullopt;
+    }
+
+    // CreateFileMapping rejects an empty file, so there is nothing to map
+    if (file_size.QuadPart == 0)
+    {
+        CloseHandle(hFile);
+        SYSTEM_INFO system_info{};
+        GetSystemInfo(&system_info);
+        return File{
+            .buffer = nullptr,
+            .buffer_size = 0,
+            .bytes_read = 0,
+            .alignment = system_info.dwAllocationGranularity,
+            .allocation_type = AllocationType::Mapped,
+        };
+    }
+
+    HANDLE hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    // The mapping keeps its own reference to the file, and the view keeps its own reference to the mapping
+    CloseHandle(hFile);
+    if (hMapping == NULL)
+    {
+        return std::nullopt;
+    }
+
+    void* view = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(hMapping);
+    if (view == NULL)
+    {
+        return std::nullopt;
+    }
+
+    size_t size = static_cast<size_t>(file_size.QuadPart);
+
+    if (hint != MappedLoadHint::Lazy)
+    {
+        WIN32_MEMORY_RANGE_ENTRY range{
+            .VirtualAddress = view,
+            .NumberOfBytes = size,
+        };
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+
+    SYSTEM_INFO system_info{};
+    GetSystemInfo(&system_info);
+
+    if (hint == MappedLoadHint::Prefault)
+    {
+        // PrefetchVirtualMemory is only a hint, so touch every page to guarantee it is resident
+        volatile const char* bytes = static_cast<const char*>(view);
+        for (size_t offset = 0; offset < size; offset += system_info.dwPageSize)
+        {
+            (void)bytes[offset]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+    }
+
+    return File{
+        .buffer = view,
+        .buffer_size = size,
+        .bytes_read = size,
+        .alignment = system_info.dwAllocationGranularity,
+        .allocation_type = AllocationType::Mapped,
+    };
+}
+
+auto load_file_range(std::string_view file, uint64_t offset, uint64_t length, FileLoadStrategy load_strategy)
+    -> std::optional<File>
+{
+    const FileRange range{
+        .offset = offset,
+        .length = length,
+    };
+    std::vector<std::optional<File>> files = load_file_ranges(file, std::span(&range, 1), load_strategy);
+    return files.front();
+}
+
+auto load_file_range_async(std::string_view file, uint64_t offset, uint64_t length, FileLoadStrategy load_strategy)
+    -> std::optional<FileFuture>
+{
+    if (load_strategy == FileLoadStrategy::StdLibrary)
+    {
+        return FileFuture::from_future(
+            std::async(std::launch::async, load_file_range, std::string(file), offset, length, load_strategy));
+    }
+    if (load_strategy == FileLoadStrategy::Mapped)
+    {
+        // Creating the view does not read the file, so the FileFuture is ready immediately
+        std::optional<File> f = load_file_range(file, offset, length, load_strategy);
+        if (!f)
+        {
+            return std::nullopt;
+        }
+        return FileFuture::from_result(f);
+    }
+    if (load_strategy != FileLoadStrategy::AllowCached && load_strategy != FileLoadStrategy::SafeDirectDisk)
+    {
+        return std::nullopt;
+    }
+
+    const bool direct = load_strategy == FileLoadStrategy::SafeDirectDisk;
+    FileMetaData meta_data{};
+    HANDLE hFile = open_for_range(file, direct, true, meta_data);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return std::nullopt;
+    }
+
+    RangeLoad range = prepare_range(meta_data, offset, length);
+
+    std::unique_ptr<OVERLAPPED> overlapped = std::make_unique<OVERLAPPED>();
+    overlapped->hEvent = CreateEvent(NULL,  // Security Attributes
+                                     TRUE,  // Manual Reset required
+                                     FALSE, // Start signaled
+                                     NULL); // Name
+
+    if (overlapped->hEvent == NULL || !start_range_read(hFile, range, *overlapped))
+    {
+        if (overlapped->hEvent != NULL)
+        {
+            CloseHandle(overlapped->hEvent);
+        }
+        CloseHandle(hFile);
+        free_file(range.file);
+        return std::nullopt;
+    }
+
+    return FileFuture(std::make_unique<OverlappedLoadState>(hFile, std::move(overlapped), range.file, range.length));
+}
+
+auto load_file_ranges(std::string_view file, std::span<const FileRange> ranges, FileLoadStrategy load_strategy)
+    -> std::vector<std::optional<File>>
+{
+    std::vector<std::optional<File>> files(ranges.size());
+
+    if (load_strategy == FileLoadStrategy::StdLibrary)
+    {
+        std::ifstream f(std::string(file), std::ios::binary | std::ios::ate);
+        if (!f.is_open())
+        {
+            return files;
+        }
+        const std::streamoff file_size = f.tellg();
+        if (file_size < 0)
+        {
+            return files;
+        }
+        for (size_t i = 0; i < ranges.size(); i++)
+        {
+            files[i] = load_range_standard_library(f,
+                                                  static_cast<uint64_t>(file_size),
+                                                  ranges[i].offset,
+                                                  ranges[i].length);
+        }
+        return files;
+    }
+
+    if (load_strategy != FileLoadStrategy::AllowCached && load_strategy != FileLoadStrategy::SafeDirectDisk &&
+        load_strategy != FileLoadStrategy::Mapped)
+    {
+        return files;
+    }
+
+    const bool direct = load_strategy == FileLoadStrategy::SafeDirectDisk;
+    const bool mapped = load_strategy == FileLoadStrategy::Mapped;
+    FileMetaData meta_data{};
+    HANDLE hFile = open_for_range(file, direct, !mapped, meta_data);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return files;
+    }
+
+    if (mapped)
+    {
+        // An empty file cannot be mapped, but every range of it is empty and never touches the mapping
+        HANDLE hMapping = meta_data.size > 0 ? CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+        CloseHandle(hFile);
+        if (hMapping == NULL && meta_data.size > 0)
+        {
+            return files;
+        }
+        for (size_t i = 0; i < ranges.size(); i++)
+        {
+            files[i] = map_range(hMapping, meta_data, ranges[i].offset, ranges[i].length);
+        }
+        if (hMapping != NULL)
+        {
+            CloseHandle(hMapping);
+        }
+        return files;
+    }
+
+    // Every read is issued before any is waited on, so they can all be in flight at once
+    std::vector<RangeLoad> loads;
+    std::vector<OVERLAPPED> overlapped(ranges.size());
+    std::vector<bool> started(ranges.size(), false);
+    loads.reserve(ranges.size());
+    for (size_t i = 0; i < ranges.size(); i++)
+    {
+        RangeLoad& load = loads.emplace_back(prepare_range(meta_data, ranges[i].offset, ranges[i].length));
+        overlapped[i].hEvent = CreateEvent(NULL,  // Security Attributes
+                                           TRUE,  // Manual Reset required
+                                           FALSE, // Start signaled
+                                           NULL); // Name
+        started[i] = overlapped[i].hEvent != NULL && start_range_read(hFile, load, overlapped[i]);
+    }
+
+    for (size_t i = 0; i < ranges.size(); i++)
+    {
+        if (started[i])
+        {
+            files[i] = finish_range_read(hFile, loads[i], overlapped[i]);
+        }
+        else
+        {
+            free_file(loads[i].file);
+        }
+        if (overlapped[i].hEvent != NULL)
+        {
+            CloseHandle(overlapped[i].hEvent);
+        }
+    }
+
+    CloseHandle(hFile);
+    return files;
+}
+
+auto load_file_parallel(std::string_view file, const FileParallelLoadOptions& options, FileParallelLoadStats* stats)
+    -> std::optional<File>
+{
+    // ReadFile takes a 32 bit length. 1 GiB is a multiple of any sector size.
+    constexpr uint64_t MAX_RANGE_SIZE = uint64_t{1} << 30;
+
+    const bool direct = options.load_strategy == FileLoadStrategy::SafeDirectDisk;
+    HANDLE hFile = CreateFileA(std::string(file).c_str(),
+                               GENERIC_READ,
+                               FILE_SHARE_READ,
+                               NULL,
+                               OPEN_EXISTING,
+                               FILE_FLAG_OVERLAPPED | (direct ? FILE_FLAG_NO_BUFFERING : FILE_FLAG_SEQUENTIAL_SCAN),
+                               NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return std::nullopt;
+    }
+
+    // The logical end of the file, rather than its allocation size on disk
+    LARGE_INTEGER file_size{};
+    std::optional<size_t> maybe_file_alignment = direct ? get_alignment_from_file(hFile) : 1;
+    if (GetFileSizeEx(hFile, &file_size) == FALSE || !maybe_file_alignment)
+    {
+        CloseHandle(hFile);
+        return std::nullopt;
+    }
+    const uint64_t file_alignment = maybe_file_alignment.value();
+
+    // When NO_BUFFERING is specified, file size to work with has to be a multiple of the alignment.
+    File f = allocate_file(dae::align_up(static_cast<uint64_t>(file_size.QuadPart), file_alignment),
+                           file_alignment,
+                           options.pool);
+
+    const uint64_t range_size =
+        dae::align_up(std::clamp<uint64_t>(options.range_size, 1, MAX_RANGE_SIZE), file_alignment);
+    const uint64_t range_count = (f.buffer_size + range_size - 1) / range_size;
+    const uint32_t slot_count = static_cast<uint32_t>(
+        std::clamp<uint64_t>(options.thread_count, 1, std::clamp<uint64_t>(range_count, 1, MAXIMUM_WAIT_OBJECTS)));
+
+    // One overlapped read per slot. An OVERLAPPED must not move while its read is in flight, so the slots stay put and
+    // the events of the slots with a read in flight are gathered at the front of a separate array to wait on.
+    std::vector<OVERLAPPED> slots(slot_count);
+    std::vector<HANDLE> events(slot_count);
+    std::vector<size_t> event_slots(slot_count);
+    bool failed = false;
+    for (size_t i = 0; i < slot_count; i++)
+    {
+        slots[i].hEvent = CreateEvent(NULL,  // Security Attributes
+                                      TRUE,  // Manual Reset required
+                                      FALSE, // Start signaled
+                                      NULL); // Name
+        events[i] = slots[i].hEvent;
+        event_slots[i] = i;
+        failed = failed || slots[i].hEvent == NULL;
+    }
+
+    uint64_t next_range = 0;
+    uint64_t bytes_read = 0;
+
+    auto issue_read = [&](size_t slot_index) -> bool {
+        OVERLAPPED& slot = slots[slot_index];
+        const uint64_t offset = next_range * range_size;
+        const uint64_t size = std::min(range_size, f.buffer_size - offset);
+        next_range++;
+
+        ResetEvent(slot.hEvent);
+        slot.Offset = static_cast<DWORD>(offset);
+        slot.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        void* target = static_cast<char*>(f.buffer) + offset; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        BOOL result = ReadFile(hFile, target, static_cast<DWORD>(size), NULL, &slot);
+        return result != FALSE || GetLastError() == ERROR_IO_PENDING;
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+
+    size_t active = 0;
+    while (!failed && active < slot_count && next_range < range_count)
+    {
+        if (!issue_read(active))
+        {
+            failed = true;
+            break;
+        }
+        active++;
+    }
+
+    while (active > 0)
+    {
+        DWORD wait = WaitForMultipleObjects(static_cast<DWORD>(active), events.data(), FALSE, INFINITE);
+        if (wait >= WAIT_OBJECT_0 + active)
+        {
+            // Nothing sensible can be done with the buffer while reads may still land in it, so wait them out
+            failed = true;
+            CancelIoEx(hFile, NULL);
+            for (size_t i = 0; i < active; i++)
+            {
+                DWORD ignored = 0;
+                GetOverlappedResult(hFile, &slots[event_slots[i]], &ignored, TRUE);
+            }
+            break;
+        }
+
+        const size_t event_index = wait - WAIT_OBJECT_0;
+        const size_t slot_index = event_slots[event_index];
+        DWORD range_read = 0;
+        if (GetOverlappedResult(hFile, &slots[slot_index], &range_read, TRUE) == FALSE &&
+            GetLastError() != ERROR_HANDLE_EOF)
+        {
+            if (!failed)
+            {
+                failed = true;
+                CancelIoEx(hFile, NULL);
+            }
+        }
+        bytes_read += range_read;
+
+        if (!failed && next_range < range_count)
+        {
+            if (issue_read(slot_index))
+            {
+                continue;
+            }
+            failed = true;
+            CancelIoEx(hFile, NULL);
+        }
+
+        // Retire the slot by swapping its event with the last active one
+        active--;
+        std::swap(events[event_index], events[active]);
+        std::swap(event_slots[event_index], event_slots[active]);
+    }
+
+    const std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - start;
+
+    for (OVERLAPPED& slot : slots)
+    {
+        if (slot.hEvent != NULL)
+        {
+            CloseHandle(slot.hEvent);
+        }
+    }
+    CloseHandle(hFile);
+
+    if (failed)
+    {
+        free_file(f);
+        return std::nullopt;
+    }
+
+    f.bytes_read = std::min<uint64_t>(bytes_read, file_size.QuadPart);
+
+    if (stats != nullptr)
+    {
+        const double seconds = std::chrono::duration<double>(duration).count();
+        *stats = FileParallelLoadStats{
+            .bytes_read = f.bytes_read,
+            .range_count = range_count,
+            .thread_count = slot_count,
+            .duration = duration,
+            .bytes_per_second = seconds > 0.0 ? static_cast<double>(f.bytes_read) / seconds : 0.0,
+        };
+    }
+
+    return f;
+}
+
+auto load_file_checked(std::string_view file,
+                       std::optional<uint32_t> expected_crc32c,
+                       FileLoadStrategy load_strategy,
+                       uint32_t* crc32c) -> std::optional<File>
+{
+    uint32_t crc = 0;
+    std::optional<File> f;
+    if (load_strategy == FileLoadStrategy::AllowCached || load_strategy == FileLoadStrategy::SafeDirectDisk)
+    {
+        f = load_file_checked_overlapped(file, load_strategy == FileLoadStrategy::SafeDirectDisk, crc);
+    }
+    else
+    {
+        f = load_file(file, load_strategy);
+        if (f)
+        {
+            crc = dae::io::crc32c(get_file_data(f.value()));
+        }
+    }
+
+    if (!f)
+    {
+        return std::nullopt;
+    }
+
+    if (crc32c != nullptr)
+    {
+        *crc32c = crc;
+    }
+
+    if (expected_crc32c && expected_crc32c.value() != crc)
+    {
+        free_file(f.value());
+        return std::nullopt;
+    }
+    return f;
+}
+
+namespace
+{
+/**
+ * @brief Dispatches load_file_async to the implementation for a strategy.
+ */
+auto load_file_async_with_strategy(std::string_view file, FileLoadStrategy load_strategy, FileBufferPool* pool)
+    -> std::optional<FileFuture>
+{
+    switch (load_strategy)
+    {
+    case FileLoadStrategy::StdLibrary:
+        return load_file_standard_library_async(file, pool);
+    case FileLoadStrategy::AllowCached:
+        return load_file_allow_cached_async(file, pool);
+    case FileLoadStrategy::SafeDirectDisk:
+        return load_file_safe_direct_disk_async(file, pool);
+    case FileLoadStrategy::Mapped:
+        return load_file_mapped_async(file);
+    default:
+        return std::nullopt;
+    }
+}
+} // namespace
+
+auto load_file_async(std::string_view file, FileLoadStrategy load_strategy) -> std::optional<FileFuture>
+{
+    return load_file_async_with_strategy(file, load_strategy, nullptr);
+}
+
+auto load_file_async(std::string_view file, FileLoadStrategy load_strategy, FileBufferPool& pool)
+    -> std::optional<FileFuture>
+{
+    return load_file_async_with_strategy(file, load_strategy, &pool);
+}
+
+auto load_files_async(std::span<const std::string_view> file_paths, FileLoadStrategy load_strategy)
+    -> std::vector<std::optional<FileFuture>>
+{
+    // Overlapped reads are issued as each file is opened, so there is no separate submission to batch
+    std::vector<std::optional<FileFuture>> futures(file_paths.size());
+    for (size_t i = 0; i < file_paths.size(); i++)
+    {
+        futures[i] = load_file_async_with_strategy(file_paths[i], load_strategy, nullptr);
+    }
+    return futures;
+}
+
+auto save_file(std::string_view file, std::span<const std::byte> data, const FileSaveOptions& options) -> bool
+{
+    if (options.save_strategy == FileLoadStrategy::StdLibrary)
+    {
+        return save_file_standard_library(file, data, options);
+    }
+    if (options.save_strategy != FileLoadStrategy::AllowCached &&
+        options.save_strategy != FileLoadStrategy::SafeDirectDisk)
+    {
+        return false;
+    }
+
+    std::optional<PendingSave> pending = open_for_save(file, options);
+    if (!pending)
+    {
+        return false;
+    }
+
+    bool success = write_save(pending.value(), data) && sync_save(pending->hFile, options.sync_mode);
+    return finish_save(pending.value(), success, options);
+}
+
+auto save_files(std::span<const FileSaveRequest> requests, const FileSaveOptions& options) -> std::vector<bool>
+{
+    std::vector<bool> results(requests.size(), false);
+
+    if (options.save_strategy == FileLoadStrategy::StdLibrary)
+    {
+        for (size_t i = 0; i < requests.size(); i++)
+        {
+            results[i] = save_file_standard_library(requests[i].file_path, requests[i].data, options);
+        }
+        return results;
+    }
+    if (options.save_strategy != FileLoadStrategy::AllowCached &&
+        options.save_strategy != FileLoadStrategy::SafeDirectDisk)
+    {
+        return results;
+    }
+
+    // Write everything first, then flush everything
+    std::vector<std::optional<PendingSave>> pending(requests.size());
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        pending[i] = open_for_save(requests[i].file_path, options);
+        if (pending[i])
+        {
+            results[i] = write_save(pending[i].value(), requests[i].data);
+        }
+    }
+
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        if (results[i])
+        {
+            results[i] = sync_save(pending[i]->hFile, options.sync_mode);
+        }
+    }
+
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        if (pending[i])
+        {
+            results[i] = finish_save(pending[i].value(), results[i], options);
+        }
+    }
+
+    return results;
 }
 
 auto get_file_meta_data(std::string_view file) -> std::optional<FileMetaData>
@@ -434,10 +1664,11 @@ auto get_file_meta_data(std::string_view file) -> std::optional<FileMetaData>
 
     std::optional<size_t> maybe_size = get_size_from_file(hFile);
     std::optional<size_t> maybe_alignment = get_alignment_from_file(hFile);
+    std::optional<int64_t> maybe_modified_time = get_modified_time_from_file(hFile);
 
     CloseHandle(hFile);
 
-    if (!maybe_alignment || !maybe_size)
+    if (!maybe_alignment || !maybe_size || !maybe_modified_time)
     {
         return std::nullopt;
     }
@@ -445,6 +1676,7 @@ auto get_file_meta_data(std::string_view file) -> std::optional<FileMetaData>
     return FileMetaData{
         .size = maybe_size.value(),
         .alignment = maybe_alignment.value(),
+        .modified_time_ns = maybe_modified_time.value(),
     };
 }
 
@@ -0,0 +1,222 @@
+#include "daedalus/io/file_watcher.h"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+
+namespace dae::io
+{
+
+namespace
+{
+// Renames are reported on both sides, so files saved by renaming a temporary file over them are seen
+constexpr DWORD NOTIFY_FILTER = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE;
+
+constexpr size_t EVENT_BUFFER_SIZE = static_cast<size_t>(64) * 1024;
+
+// Waiting on more directories than WaitForMultipleObjects can take at once falls back to polling them this often
+constexpr DWORD OVERFLOW_POLL_INTERVAL_MS = 10;
+
+/**
+ * @brief An open directory and its in-flight `ReadDirectoryChangesW` call. Owns the event that signals its
+ * completion.
+ */
+struct DirectoryWatch
+{
+    HANDLE hDirectory{INVALID_HANDLE_VALUE};
+    OVERLAPPED overlapped{};
+    alignas(DWORD) std::array<std::byte, EVENT_BUFFER_SIZE> buffer{};
+    /**
+     * @brief Whether a read is in flight. Stays false if the directory stops being readable, such as after it is
+     * deleted.
+     */
+    bool reading{false};
+
+    DirectoryWatch() = default;
+    ~DirectoryWatch()
+    {
+        if (reading)
+        {
+            // The read has to be finished before the buffer it writes to can go away
+            CancelIoEx(hDirectory, &overlapped);
+            DWORD bytes = 0;
+            GetOverlappedResult(hDirectory, &overlapped, &bytes, TRUE);
+        }
+        if (hDirectory != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(hDirectory);
+        }
+        if (overlapped.hEvent != NULL)
+        {
+            CloseHandle(overlapped.hEvent);
+        }
+    }
+
+    DirectoryWatch(const DirectoryWatch& other) = delete;
+    auto operator=(const DirectoryWatch& other) -> DirectoryWatch& = delete;
+    DirectoryWatch(DirectoryWatch&& other) noexcept = delete;
+    auto operator=(DirectoryWatch&& other) noexcept -> DirectoryWatch& = delete;
+};
+
+auto start_read(DirectoryWatch& watch) -> bool
+{
+    ResetEvent(watch.overlapped.hEvent);
+    watch.reading = ReadDirectoryChangesW(watch.hDirectory,
+                                          watch.buffer.data(),
+                                          static_cast<DWORD>(watch.buffer.size()),
+                                          FALSE,
+                                          NOTIFY_FILTER,
+                                          NULL,
+                                          &watch.overlapped,
+                                          NULL) != FALSE;
+    return watch.reading;
+}
+
+auto to_change_type(DWORD action) -> FileChangeType
+{
+    switch (action)
+    {
+    case FILE_ACTION_ADDED:
+        return FileChangeType::Created;
+    case FILE_ACTION_REMOVED:
+    case FILE_ACTION_RENAMED_OLD_NAME:
+        return FileChangeType::Removed;
+    default:
+        // A file renamed in over a name may or may not be replacing a file, and is treated as the file being rewritten
+        return FileChangeType::Modified;
+    }
+}
+
+/**
+ * @brief Converts a file name from a change notification to the same code page as the paths passed to CreateFileA.
+ */
+auto to_narrow(const WCHAR* name, DWORD length) -> std::string
+{
+    const int size = WideCharToMultiByte(CP_ACP, 0, name, static_cast<int>(length), NULL, 0, NULL, NULL);
+    std::string narrow(static_cast<size_t>(std::max(size, 0)), '\0');
+    WideCharToMultiByte(CP_ACP, 0, name, static_cast<int>(length), narrow.data(), size, NULL, NULL);
+    return narrow;
+}
+} // namespace
+
+auto FileWatcher::open_native() -> std::optional<intptr_t>
+{
+    // Each directory is opened on its own, so there is nothing shared to set up
+    return 0;
+}
+
+auto FileWatcher::close_native() -> void
+{
+}
+
+auto FileWatcher::add_native_watch(Watch& watch) -> bool
+{
+    std::shared_ptr<DirectoryWatch> directory = std::make_shared<DirectoryWatch>();
+    directory->hDirectory = CreateFileA(watch.directory.c_str(),
+                                        FILE_LIST_DIRECTORY,
+                                        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                        NULL,
+                                        OPEN_EXISTING,
+                                        FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED,
+                                        NULL);
+    if (directory->hDirectory == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    directory->overlapped.hEvent = CreateEvent(NULL,  // Security Attributes
+                                               TRUE,  // Manual Reset required
+                                               FALSE, // Start signaled
+                                               NULL); // Name
+    if (directory->overlapped.hEvent == NULL || !start_read(*directory))
+    {
+        return false;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    watch.handle = reinterpret_cast<intptr_t>(directory->hDirectory);
+    watch.native_state = std::move(directory);
+    return true;
+}
+
+auto FileWatcher::remove_native_watch(Watch& watch) -> void
+{
+    // The DirectoryWatch destructor cancels the read and closes the directory
+    watch.native_state.reset();
+    watch.handle = -1;
+}
+
+auto FileWatcher::read_native_events() -> void
+{
+    for (const std::unique_ptr<Watch>& watch : watches)
+    {
+        DirectoryWatch& directory = *std::static_pointer_cast<DirectoryWatch>(watch->native_state);
+        if (!directory.reading || !HasOverlappedIoCompleted(&directory.overlapped))
+        {
+            continue;
+        }
+        directory.reading = false;
+
+        DWORD bytes = 0;
+        if (GetOverlappedResult(directory.hDirectory, &directory.overlapped, &bytes, FALSE) != FALSE)
+        {
+            // A completed read with nothing in it means more changes happened than the buffer could hold
+            if (bytes == 0)
+            {
+                on_overflow();
+            }
+
+            for (DWORD offset = 0; bytes != 0;)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                const FILE_NOTIFY_INFORMATION* info =
+                    reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(directory.buffer.data() + offset);
+                on_event(*watch,
+                         to_narrow(static_cast<const WCHAR*>(info->FileName), info->FileNameLength / sizeof(WCHAR)),
+                         to_change_type(info->Action));
+
+                if (info->NextEntryOffset == 0)
+                {
+                    break;
+                }
+                offset += info->NextEntryOffset;
+            }
+        }
+
+        start_read(directory);
+    }
+}
+
+auto FileWatcher::wait_native(std::chrono::milliseconds timeout) -> void
+{
+    std::array<HANDLE, MAXIMUM_WAIT_OBJECTS> events{};
+    DWORD event_count = 0;
+    for (const std::unique_ptr<Watch>& watch : watches)
+    {
+        if (event_count == events.size())
+        {
+            break;
+        }
+        events[event_count++] = std::static_pointer_cast<DirectoryWatch>(watch->native_state)->overlapped.hEvent;
+    }
+
+    DWORD timeout_ms = static_cast<DWORD>(timeout.count());
+    if (watches.size() > events.size())
+    {
+        timeout_ms = std::min(timeout_ms, OVERFLOW_POLL_INTERVAL_MS);
+    }
+
+    if (event_count == 0)
+    {
+        Sleep(timeout_ms);
+        return;
+    }
+    WaitForMultipleObjects(event_count, events.data(), FALSE, timeout_ms);
+}
+
+} // namespace dae::io
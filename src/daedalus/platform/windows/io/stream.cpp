@@ -0,0 +1,133 @@
+#include "daedalus/io/stream.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+
+namespace dae::io
+{
+
+namespace
+{
+/**
+ * @brief An in-flight overlapped read. Owns the event that signals its completion.
+ */
+struct OverlappedRead
+{
+    OVERLAPPED overlapped{};
+
+    OverlappedRead() = default;
+    ~OverlappedRead()
+    {
+        if (overlapped.hEvent != NULL)
+        {
+            CloseHandle(overlapped.hEvent);
+        }
+    }
+
+    OverlappedRead(const OverlappedRead& other) = delete;
+    auto operator=(const OverlappedRead& other) -> OverlappedRead& = delete;
+    OverlappedRead(OverlappedRead&& other) noexcept = delete;
+    auto operator=(OverlappedRead&& other) noexcept -> OverlappedRead& = delete;
+};
+
+auto to_handle(intptr_t handle) -> HANDLE
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,performance-no-int-to-ptr)
+    return reinterpret_cast<HANDLE>(handle);
+}
+} // namespace
+
+auto FileStreamReader::open_native(std::string_view file_path, bool direct) -> std::optional<NativeFile>
+{
+    std::optional<FileMetaData> meta_data = get_file_meta_data(file_path);
+    if (!meta_data)
+    {
+        return std::nullopt;
+    }
+
+    HANDLE hFile = CreateFileA(std::string(file_path).c_str(),
+                               GENERIC_READ,
+                               FILE_SHARE_READ,
+                               NULL,
+                               OPEN_EXISTING,
+                               FILE_FLAG_OVERLAPPED | (direct ? FILE_FLAG_NO_BUFFERING : FILE_FLAG_SEQUENTIAL_SCAN),
+                               NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return std::nullopt;
+    }
+
+    // The logical end of the file, rather than its allocation size on disk
+    LARGE_INTEGER file_size{};
+    if (GetFileSizeEx(hFile, &file_size) == FALSE)
+    {
+        CloseHandle(hFile);
+        return std::nullopt;
+    }
+
+    return NativeFile{
+        .handle = reinterpret_cast<intptr_t>(hFile), // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        .size = static_cast<uint64_t>(file_size.QuadPart),
+        .alignment = direct ? meta_data->alignment : 1,
+        .pending_read = nullptr,
+    };
+}
+
+auto FileStreamReader::close_native(NativeFile& file) -> void
+{
+    CloseHandle(to_handle(file.handle));
+}
+
+auto FileStreamReader::start_read(NativeFile& file, void* buffer, uint64_t size, uint64_t offset) -> bool
+{
+    std::shared_ptr<OverlappedRead> read = std::make_shared<OverlappedRead>();
+    read->overlapped.Offset = static_cast<DWORD>(offset);
+    read->overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    read->overlapped.hEvent = CreateEvent(NULL,  // Security Attributes
+                                          TRUE,  // Manual Reset required
+                                          FALSE, // Start signaled
+                                          NULL); // Name
+    if (read->overlapped.hEvent == NULL)
+    {
+        return false;
+    }
+
+    BOOL result = ReadFile(to_handle(file.handle), buffer, static_cast<DWORD>(size), NULL, &read->overlapped);
+    if (result == FALSE && GetLastError() != ERROR_IO_PENDING && GetLastError() != ERROR_HANDLE_EOF)
+    {
+        return false;
+    }
+
+    file.pending_read = std::move(read);
+    return true;
+}
+
+auto FileStreamReader::finish_read(NativeFile& file) -> std::optional<uint64_t>
+{
+    std::shared_ptr<OverlappedRead> read =
+        std::static_pointer_cast<OverlappedRead>(std::exchange(file.pending_read, nullptr));
+    if (!read)
+    {
+        return std::nullopt;
+    }
+
+    DWORD bytes_read = 0;
+    if (GetOverlappedResult(to_handle(file.handle), &read->overlapped, &bytes_read, TRUE) == FALSE)
+    {
+        // Reading at or past the end of the file is reported as an error, but is just an empty read
+        if (GetLastError() == ERROR_HANDLE_EOF)
+        {
+            return 0;
+        }
+        return std::nullopt;
+    }
+
+    return bytes_read;
+}
+
+} // namespace dae::io
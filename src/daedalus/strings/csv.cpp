@@ -0,0 +1,211 @@
+#include "daedalus/strings/csv.h"
+
+#include "daedalus/strings/utils.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+
+namespace dae::strings
+{
+
+namespace
+{
+constexpr size_t BLOCK_SIZE = 64;
+
+/**
+ * @brief Sets every bit from each set bit up to, but not including, the next one. Applied to the quotes of a block,
+ * this gives a mask of the bytes inside quotes, where the opening quote counts as inside and the closing one does not.
+ * An escaped quote is two quotes in a row, so it closes and reopens the quotes without changing anything around it.
+ */
+auto prefix_xor(uint64_t bits) -> uint64_t
+{
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+} // namespace
+
+CsvTokenizer::CsvTokenizer(const CsvOptions& options) : options(options), classify(kernels::get_kernels().classify)
+{
+}
+
+auto CsvTokenizer::feed(std::string_view new_chunk) -> bool
+{
+    // The unread tail of the chunk is only moved into carry once next() has run out of records
+    if (structural != 0 || next_block_offset < chunk.size() || record_start < chunk.size())
+    {
+        return false;
+    }
+    chunk = new_chunk;
+    block_offset = 0;
+    next_block_offset = 0;
+    record_start = 0;
+    return true;
+}
+
+auto CsvTokenizer::feed(std::span<const std::byte> new_chunk) -> bool
+{
+    return feed(std::string_view(reinterpret_cast<const char*>(new_chunk.data()), new_chunk.size())); // NOLINT
+}
+
+auto CsvTokenizer::finish() -> void
+{
+    finished = true;
+}
+
+auto CsvTokenizer::next() -> std::optional<CsvRecord>
+{
+    if (carry_returned)
+    {
+        carry.clear();
+        carry_returned = false;
+    }
+
+    for (std::optional<size_t> pos = next_structural(); pos; pos = next_structural())
+    {
+        field_ends.push_back(carry.size() + pos.value() - record_start);
+        if (chunk[pos.value()] != '\n')
+        {
+            continue;
+        }
+
+        std::string_view record = chunk.substr(record_start, pos.value() - record_start);
+        record_start = pos.value() + 1;
+        if (!carry.empty())
+        {
+            carry.append(record);
+            record = carry;
+            carry_returned = true;
+        }
+        return build_record(record);
+    }
+
+    // The chunk ran out partway through a record, so hold on to what there is of it until the next chunk
+    if (record_start < chunk.size())
+    {
+        carry.append(chunk.substr(record_start));
+        record_start = chunk.size();
+    }
+    if (finished && (!carry.empty() || !field_ends.empty()))
+    {
+        field_ends.push_back(carry.size());
+        inside_quotes = 0;
+        carry_returned = true;
+        return build_record(carry);
+    }
+    return std::nullopt;
+}
+
+auto CsvTokenizer::next_structural() -> std::optional<size_t>
+{
+    while (structural == 0)
+    {
+        if (next_block_offset >= chunk.size())
+        {
+            return std::nullopt;
+        }
+        block_offset = next_block_offset;
+        next_block_offset += BLOCK_SIZE;
+
+        kernels::BlockClasses classes;
+        const size_t length = std::min(BLOCK_SIZE, chunk.size() - block_offset);
+        if (length == BLOCK_SIZE)
+        {
+            classes = classify(chunk.data() + block_offset, options.delim, options.quote); // NOLINT
+        }
+        else
+        {
+            // The end of the chunk is copied out rather than read past, and anything found after it is masked off
+            std::array<char, BLOCK_SIZE> padded{};
+            std::memcpy(padded.data(), chunk.data() + block_offset, length); // NOLINT
+            classes = classify(padded.data(), options.delim, options.quote);
+            const uint64_t in_chunk = (uint64_t{1} << length) - 1;
+            classes.quotes &= in_chunk;
+            classes.delims &= in_chunk;
+            classes.newlines &= in_chunk;
+        }
+
+        const uint64_t inside = prefix_xor(options.quoting ? classes.quotes : 0) ^ inside_quotes;
+        // Carry the state after the last byte into the next block, as all ones or all zeros
+        inside_quotes = static_cast<uint64_t>(static_cast<int64_t>(inside) >> 63);
+        structural = (classes.delims | classes.newlines) & ~inside;
+    }
+
+    const size_t pos = block_offset + static_cast<size_t>(std::countr_zero(structural));
+    structural &= structural - 1;
+    return pos;
+}
+
+auto CsvTokenizer::build_record(std::string_view record) -> CsvRecord
+{
+    fields.clear();
+    unescaped.clear();
+    // Unescaping never makes a field longer, so this is enough to keep every unescaped view stable
+    unescaped.reserve(record.size());
+
+    size_t start = 0;
+    for (size_t i = 0; i < field_ends.size(); i++)
+    {
+        std::string_view raw = record.substr(start, field_ends[i] - start);
+        if (i + 1 == field_ends.size() && raw.ends_with('\r'))
+        {
+            raw.remove_suffix(1);
+        }
+        if (options.trim_fields)
+        {
+            raw = trim(raw);
+        }
+        fields.push_back(options.quoting ? unquote(raw) : raw);
+        start = field_ends[i] + 1;
+    }
+    field_ends.clear();
+    return fields;
+}
+
+auto CsvTokenizer::unquote(std::string_view raw) -> std::string_view
+{
+    if (raw.empty() || raw.front() != options.quote)
+    {
+        return raw;
+    }
+
+    const std::string_view inner = raw.substr(1);
+    const size_t first_quote = inner.find(options.quote);
+    if (first_quote == std::string_view::npos)
+    {
+        return inner;
+    }
+    if (first_quote == inner.size() - 1)
+    {
+        return inner.substr(0, first_quote);
+    }
+
+    const size_t unescaped_start = unescaped.size();
+    bool closed = false;
+    for (size_t i = 0; i < inner.size(); i++)
+    {
+        if (!closed && inner[i] == options.quote)
+        {
+            if (i + 1 < inner.size() && inner[i + 1] == options.quote)
+            {
+                unescaped.push_back(options.quote);
+                i++;
+            }
+            else
+            {
+                closed = true;
+            }
+            continue;
+        }
+        unescaped.push_back(inner[i]);
+    }
+    return {unescaped.data() + unescaped_start, unescaped.size() - unescaped_start}; // NOLINT
+}
+
+} // namespace dae::strings
@@ -0,0 +1,135 @@
+#ifndef DAEDALUS_STRINGS_CSV_H
+#define DAEDALUS_STRINGS_CSV_H
+
+#include "daedalus/strings/kernels.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dae::strings
+{
+
+/**
+ * @brief Settings for a CsvTokenizer. The defaults read RFC 4180 CSV; use `{.delim = '\t', .quoting = false}` for
+ * TSV.
+ */
+struct CsvOptions
+{
+    char delim{','};
+    char quote{'"'};
+    /**
+     * @brief If false, quotes are treated as ordinary characters.
+     */
+    bool quoting{true};
+    /**
+     * @brief Trims whitespace from the front and back of every field, outside of any quotes.
+     */
+    bool trim_fields{false};
+};
+
+/**
+ * @brief The fields of one record. Only valid until the next call to `CsvTokenizer::next()` or
+ * `CsvTokenizer::feed()`.
+ */
+using CsvRecord = std::span<const std::string_view>;
+
+/**
+ * @brief A streaming tokenizer for CSV and TSV, fed one chunk of text at a time.
+ *
+ * Records end at '\n', with a '\r' before it dropped. A field that starts with a quote runs until the matching quote,
+ * and may hold delimiters, newlines, and escaped quotes written as two quotes. Text between a closing quote and the
+ * next delimiter is kept as is, rather than being an error.
+ *
+ * Fields are string_views of the chunk they were found in wherever possible. Only fields with escaped quotes, and
+ * records that straddle two chunks, are copied into the tokenizer's own storage.
+ *
+ * Each chunk is classified 64 bytes at a time with the string kernels, finding every quote, delimiter, and newline
+ * in one pass. The quotes are turned into a mask of which bytes are inside quotes with a prefix XOR, so delimiters
+ * and newlines inside quotes are skipped without looking at them.
+ *
+ * @note A chunk must be kept alive until it has been fully read with `next()`, and every record read from it is no
+ * longer in use.
+ */
+class CsvTokenizer
+{
+  public:
+    explicit CsvTokenizer(const CsvOptions& options = {});
+
+    /**
+     * @brief Hands the tokenizer the next chunk of text.
+     *
+     * @param chunk The text, which continues on from the end of the last chunk.
+     *
+     * @return False if the last chunk has not been fully read with `next()` yet, in which case nothing is done.
+     */
+    auto feed(std::string_view chunk) -> bool;
+
+    /**
+     * @brief Hands the tokenizer the next chunk of text, such as a `dae::io` buffer.
+     */
+    auto feed(std::span<const std::byte> chunk) -> bool;
+
+    /**
+     * @brief Marks the end of the text, so that a last record without a trailing newline is returned by `next()`.
+     */
+    auto finish() -> void;
+
+    /**
+     * @brief Reads the next complete record.
+     *
+     * @return The record, or std::nullopt once the current chunk has been used up. Feed the next chunk and call it
+     * again to carry on.
+     */
+    [[nodiscard]] auto next() -> std::optional<CsvRecord>;
+
+  private:
+    /**
+     * @brief Finds the next delimiter or newline in the chunk that is not inside quotes.
+     *
+     * @return Its offset in the chunk, or std::nullopt at the end of the chunk.
+     */
+    auto next_structural() -> std::optional<size_t>;
+
+    /**
+     * @brief Turns the field ends of the record in `record` into fields.
+     */
+    auto build_record(std::string_view record) -> CsvRecord;
+
+    /**
+     * @brief Removes the quotes around a field, copying it into `unescaped` only if it has escaped quotes.
+     */
+    auto unquote(std::string_view raw) -> std::string_view;
+
+    CsvOptions options;
+    kernels::ClassifyFunction classify{nullptr};
+
+    std::string_view chunk;
+    bool finished{false};
+
+    // The block being read, and the structural characters in it that have not been read yet
+    size_t block_offset{0};
+    size_t next_block_offset{0};
+    uint64_t structural{0};
+    // All ones if the last block ended inside quotes
+    uint64_t inside_quotes{0};
+
+    // Where the current record starts in the chunk, and the end of each of its fields so far, from the record's start
+    size_t record_start{0};
+    std::vector<size_t> field_ends;
+
+    // The start of a record that began in an earlier chunk
+    std::string carry;
+    bool carry_returned{false};
+
+    std::string unescaped;
+    std::vector<std::string_view> fields;
+};
+
+} // namespace dae::strings
+
+#endif
@@ -0,0 +1,198 @@
+#include "daedalus/strings/interner.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <limits>
+
+namespace dae::strings
+{
+
+namespace
+{
+// A slot holds the string's hash in its top half and its id + 1 in its bottom half, so 0 is an empty slot
+constexpr uint64_t EMPTY_SLOT = 0;
+constexpr size_t INITIAL_CAPACITY = 2048;
+constexpr uint64_t ID_MASK = 0xFFFF'FFFF;
+
+auto make_slot(uint32_t hash, InternId id) -> uint64_t
+{
+    return (static_cast<uint64_t>(hash) << 32) | (static_cast<uint64_t>(id) + 1);
+}
+} // namespace
+
+Interner::Table::Table(size_t capacity)
+    : mask(capacity - 1), slots(std::make_unique<std::atomic<uint64_t>[]>(capacity)) // NOLINT
+{
+}
+
+Interner::Interner(size_t block_size) : block_size(block_size)
+{
+    tables.push_back(std::make_unique<Table>(INITIAL_CAPACITY));
+    table.store(tables.back().get(), std::memory_order_release);
+}
+
+Interner::~Interner() = default;
+
+auto Interner::intern(std::string_view sv) -> InternId
+{
+    const uint32_t sv_hash = hash(sv);
+    std::optional<InternId> found = find_in(*table.load(std::memory_order_acquire), sv, sv_hash);
+    if (found)
+    {
+        return found.value();
+    }
+
+    std::scoped_lock lock(mutex);
+    // Another thread may have added it between the lookup and taking the lock
+    found = find_in(*table.load(std::memory_order_relaxed), sv, sv_hash);
+    if (found)
+    {
+        return found.value();
+    }
+    return insert(Entry{.data = store(sv), .size = sv.size(), .hash = sv_hash});
+}
+
+auto Interner::intern_view(std::string_view sv) -> std::string_view
+{
+    return view(intern(sv));
+}
+
+auto Interner::find(std::string_view sv) const -> std::optional<InternId>
+{
+    return find_in(*table.load(std::memory_order_acquire), sv, hash(sv));
+}
+
+auto Interner::view(InternId id) const -> std::string_view
+{
+    const Entry& e = entry(id);
+    return {e.data, e.size};
+}
+
+auto Interner::size() const -> size_t
+{
+    return count.load(std::memory_order_acquire);
+}
+
+auto Interner::bytes_allocated() const -> size_t
+{
+    std::scoped_lock lock(mutex);
+    return allocated;
+}
+
+auto Interner::hash(std::string_view sv) -> uint32_t
+{
+    const uint64_t h = std::hash<std::string_view>{}(sv);
+    return static_cast<uint32_t>(h ^ (h >> 32));
+}
+
+auto Interner::segment_of(InternId id) -> std::pair<size_t, size_t>
+{
+    // Segment 0 holds the first FIRST_SEGMENT_SIZE ids, and every segment after it is as big as all before it
+    const auto segment = static_cast<size_t>(std::bit_width(id / FIRST_SEGMENT_SIZE));
+    const size_t segment_start = segment == 0 ? 0 : FIRST_SEGMENT_SIZE << (segment - 1);
+    return {segment, id - segment_start};
+}
+
+auto Interner::find_in(const Table& t, std::string_view sv, uint32_t sv_hash) const -> std::optional<InternId>
+{
+    for (size_t index = sv_hash & t.mask;; index = (index + 1) & t.mask)
+    {
+        const uint64_t slot = t.slots[index].load(std::memory_order_acquire);
+        if (slot == EMPTY_SLOT)
+        {
+            return std::nullopt;
+        }
+        if (static_cast<uint32_t>(slot >> 32) != sv_hash)
+        {
+            continue;
+        }
+        const auto id = static_cast<InternId>((slot & ID_MASK) - 1);
+        const Entry& e = entry(id);
+        if (e.size == sv.size() && std::memcmp(e.data, sv.data(), sv.size()) == 0)
+        {
+            return id;
+        }
+    }
+}
+
+auto Interner::entry(InternId id) const -> const Entry&
+{
+    const auto [segment, offset] = segment_of(id);
+    return segments[segment].load(std::memory_order_acquire)[offset]; // NOLINT
+}
+
+auto Interner::insert(const Entry& new_entry) -> InternId
+{
+    const size_t id_count = count.load(std::memory_order_relaxed);
+    if (id_count >= std::numeric_limits<InternId>::max())
+    {
+        std::abort();
+    }
+    const auto id = static_cast<InternId>(id_count);
+
+    const auto [segment, offset] = segment_of(id);
+    Entry* entries = segments[segment].load(std::memory_order_relaxed);
+    if (entries == nullptr)
+    {
+        const size_t segment_size = segment == 0 ? FIRST_SEGMENT_SIZE : FIRST_SEGMENT_SIZE << (segment - 1);
+        owned_segments.push_back(std::make_unique<Entry[]>(segment_size)); // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        entries = owned_segments.back().get();
+        segments[segment].store(entries, std::memory_order_release);
+    }
+    entries[offset] = new_entry; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    // Keep the table at most half full, so probes stay short
+    Table* current = table.load(std::memory_order_relaxed);
+    if ((id_count + 1) * 2 > current->mask + 1)
+    {
+        tables.push_back(std::make_unique<Table>((current->mask + 1) * 2));
+        Table* grown = tables.back().get();
+        for (InternId existing = 0; existing < id; existing++)
+        {
+            publish(*grown, entry(existing).hash, existing);
+        }
+        table.store(grown, std::memory_order_release);
+        current = grown;
+    }
+
+    publish(*current, new_entry.hash, id);
+    count.store(id_count + 1, std::memory_order_release);
+    return id;
+}
+
+auto Interner::publish(Table& t, uint32_t sv_hash, InternId id) -> void
+{
+    size_t index = sv_hash & t.mask;
+    while (t.slots[index].load(std::memory_order_relaxed) != EMPTY_SLOT)
+    {
+        index = (index + 1) & t.mask;
+    }
+    // Release, so a reader that sees the slot also sees the entry and the string it points to
+    t.slots[index].store(make_slot(sv_hash, id), std::memory_order_release);
+}
+
+auto Interner::store(std::string_view sv) -> const char*
+{
+    // Strings are null terminated, so they can be handed to C APIs as they are
+    const size_t needed = sv.size() + 1;
+    if (needed > block_remaining)
+    {
+        const size_t size = std::max(needed, block_size);
+        blocks.push_back(std::make_unique_for_overwrite<char[]>(size)); // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        allocated += size;
+        block_cursor = blocks.back().get();
+        block_remaining = size;
+    }
+
+    char* stored = block_cursor;
+    std::memcpy(stored, sv.data(), sv.size());
+    stored[sv.size()] = '\0'; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    block_cursor += needed;   // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    block_remaining -= needed;
+    return stored;
+}
+
+} // namespace dae::strings
@@ -0,0 +1,133 @@
+#ifndef DAEDALUS_STRINGS_INTERNER_H
+#define DAEDALUS_STRINGS_INTERNER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dae::strings
+{
+
+/**
+ * @brief The id of a string in an Interner. Ids are handed out densely from 0, in the order strings are first added.
+ */
+using InternId = uint32_t;
+
+/**
+ * @brief A thread-safe pool of unique strings. Each string is stored once, in large blocks of memory that never move,
+ * and is given a 32-bit id. Comparing two interned strings is then an integer compare, and repeated keys share one
+ * copy.
+ *
+ * Lookups never take a lock. Strings are found through an open addressing hash table whose slots are single atomic
+ * words, each holding a string's id and part of its hash. Adding a string takes a mutex, writes the string and its
+ * entry, and only then publishes its slot, so a reader that finds the slot always sees the whole string. When the
+ * table needs to grow, a new one is built and swapped in, and the old one is kept until the interner is destroyed so
+ * that readers still probing it are never left with a dangling pointer.
+ *
+ * @note Every string_view the interner returns stays valid, and null terminated, for the lifetime of the interner.
+ */
+class Interner
+{
+  public:
+    /**
+     * @param block_size The size of each block of string storage. Longer strings get a block of their own.
+     */
+    explicit Interner(size_t block_size = static_cast<size_t>(64) * 1024);
+    ~Interner();
+
+    Interner(const Interner& other) = delete;
+    auto operator=(const Interner& other) -> Interner& = delete;
+    Interner(Interner&& other) noexcept = delete;
+    auto operator=(Interner&& other) noexcept -> Interner& = delete;
+
+    /**
+     * @brief Gets the id of a string, adding it to the interner if it is not there yet.
+     *
+     * @note Only takes a lock if the string has to be added.
+     */
+    auto intern(std::string_view sv) -> InternId;
+
+    /**
+     * @brief Gets the interned copy of a string, adding it to the interner if it is not there yet.
+     */
+    auto intern_view(std::string_view sv) -> std::string_view;
+
+    /**
+     * @brief Looks a string up without adding it. Never takes a lock.
+     *
+     * @return The string's id, or std::nullopt if it has not been interned.
+     */
+    [[nodiscard]] auto find(std::string_view sv) const -> std::optional<InternId>;
+
+    /**
+     * @brief Gets the string with an id. Never takes a lock.
+     *
+     * @param id An id returned by this interner.
+     */
+    [[nodiscard]] auto view(InternId id) const -> std::string_view;
+
+    /**
+     * @brief Gets the number of unique strings in the interner.
+     */
+    [[nodiscard]] auto size() const -> size_t;
+
+    /**
+     * @brief Gets the number of bytes of string storage the interner has allocated.
+     */
+    [[nodiscard]] auto bytes_allocated() const -> size_t;
+
+  private:
+    struct Entry
+    {
+        const char* data;
+        size_t size;
+        uint32_t hash;
+    };
+
+    struct Table
+    {
+        explicit Table(size_t capacity);
+
+        size_t mask;
+        std::unique_ptr<std::atomic<uint64_t>[]> slots; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    };
+
+    // Entries live in segments that double in size, so that growing never moves an entry a reader might be using
+    static constexpr size_t FIRST_SEGMENT_SIZE = 1024;
+    static constexpr size_t MAX_SEGMENTS = 32;
+
+    static auto hash(std::string_view sv) -> uint32_t;
+    static auto segment_of(InternId id) -> std::pair<size_t, size_t>;
+
+    [[nodiscard]] auto find_in(const Table& table, std::string_view sv, uint32_t hash) const -> std::optional<InternId>;
+    [[nodiscard]] auto entry(InternId id) const -> const Entry&;
+    auto insert(const Entry& entry) -> InternId;
+    auto publish(Table& table, uint32_t hash, InternId id) -> void;
+    auto store(std::string_view sv) -> const char*;
+
+    const size_t block_size;
+
+    std::atomic<Table*> table{nullptr};
+    std::array<std::atomic<Entry*>, MAX_SEGMENTS> segments{};
+    std::atomic<size_t> count{0};
+
+    // Everything below is only touched while holding the mutex
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<Table>> tables;
+    std::vector<std::unique_ptr<Entry[]>> owned_segments; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    std::vector<std::unique_ptr<char[]>> blocks;          // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    char* block_cursor{nullptr};
+    size_t block_remaining{0};
+    size_t allocated{0};
+};
+
+} // namespace dae::strings
+
+#endif
@@ -0,0 +1,1006 @@
+#include "daedalus/strings/kernels.h"
+
+#include "daedalus/core/attributes.h"
+#include "daedalus/core/cpu.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if defined(DAEDALUS_ARCH_X86_64)
+#include <immintrin.h>
+#elif defined(DAEDALUS_ARCH_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace dae::strings::kernels
+{
+
+namespace
+{
+// Every vector kernel works through the buffer 64 bytes at a time, building one bit per byte
+constexpr size_t BLOCK_SIZE = 64;
+
+auto find_scalar(const char* str, size_t size, char c) -> size_t
+{
+    const void* found = std::memchr(str, c, size);
+    return found != nullptr ? static_cast<size_t>(static_cast<const char*>(found) - str) : size;
+}
+
+auto count_scalar(const char* str, size_t size, char c) -> size_t
+{
+    return static_cast<size_t>(std::count(str, str + size, c)); // NOLINT
+}
+
+/**
+ * @brief Finds every occurrence in the rest of a buffer from `offset` onwards, for the tail that is too short for a
+ * whole block.
+ *
+ * @param count The number of indices already written to `out`.
+ */
+auto find_all_from(const char* str,
+                   size_t size,
+                   size_t offset,
+                   char c,
+                   size_t bias,
+                   std::span<size_t> out,
+                   size_t count) -> size_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (size_t pos = offset + find_scalar(str + offset, size - offset, c); pos < size && count < out.size();
+         pos = pos + 1 + find_scalar(str + pos + 1, size - pos - 1, c))
+    {
+        out[count++] = bias + pos;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return count;
+}
+
+auto find_all_scalar(const char* str, size_t size, char c, size_t bias, std::span<size_t> out) -> size_t
+{
+    return find_all_from(str, size, 0, c, bias, out, 0);
+}
+
+/**
+ * @brief Writes the index of every set bit of a block's mask to `out`.
+ *
+ * @param offset The offset of the block in the buffer, plus the caller's bias.
+ * @param count The number of indices written to `out`.
+ *
+ * @return False if `out` filled up before every index in the block was written.
+ */
+auto emit_indices(size_t offset, uint64_t mask, std::span<size_t> out, size_t& count) -> bool
+{
+    for (; mask != 0; mask &= mask - 1)
+    {
+        if (count == out.size())
+        {
+            return false;
+        }
+        out[count++] = offset + static_cast<size_t>(std::countr_zero(mask));
+    }
+    return true;
+}
+
+/**
+ * @brief Splits the rest of a buffer from `offset` onwards, for the tail that is too short for a whole block.
+ *
+ * @param start Where the piece that is currently open started.
+ * @param count The number of pieces already written to `out`.
+ */
+auto split_from(const char* buf,
+                size_t size,
+                size_t start,
+                size_t offset,
+                char delim,
+                std::span<std::string_view> out,
+                size_t count) -> SplitResult
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (size_t pos = offset + find_scalar(buf + offset, size - offset, delim); pos < size;
+         pos = pos + 1 + find_scalar(buf + pos + 1, size - pos - 1, delim))
+    {
+        if (count == out.size())
+        {
+            return SplitResult{.count = count, .consumed = start};
+        }
+        out[count++] = std::string_view(buf + start, pos - start);
+        start = pos + 1;
+    }
+    if (start < size)
+    {
+        if (count == out.size())
+        {
+            return SplitResult{.count = count, .consumed = start};
+        }
+        out[count++] = std::string_view(buf + start, size - start);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return SplitResult{.count = count, .consumed = size};
+}
+
+auto split_scalar(const char* buf, size_t size, char delim, std::span<std::string_view> out) -> SplitResult
+{
+    return split_from(buf, size, 0, 0, delim, out, 0);
+}
+
+auto classify_scalar(const char* block, char delim, char quote) -> BlockClasses
+{
+    BlockClasses classes;
+    for (size_t i = 0; i < BLOCK_SIZE; i++)
+    {
+        const char c = block[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        classes.quotes |= static_cast<uint64_t>(c == quote) << i;
+        classes.delims |= static_cast<uint64_t>(c == delim) << i;
+        classes.newlines |= static_cast<uint64_t>(c == '\n') << i;
+    }
+    return classes;
+}
+
+/**
+ * @brief Skips whitespace from `offset` onwards, for the tail that is too short for a whole block.
+ */
+auto skip_whitespace_from(const char* str, size_t size, size_t offset) -> size_t
+{
+    while (offset < size && is_whitespace(str[offset])) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    {
+        offset++;
+    }
+    return offset;
+}
+
+/**
+ * @brief Skips whitespace backwards from `end`, for the head that is too short for a whole block.
+ */
+auto skip_whitespace_back_from(const char* str, size_t end) -> size_t
+{
+    while (end > 0 && is_whitespace(str[end - 1])) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    {
+        end--;
+    }
+    return end;
+}
+
+auto skip_whitespace_scalar(const char* str, size_t size) -> size_t
+{
+    return skip_whitespace_from(str, size, 0);
+}
+
+auto skip_whitespace_back_scalar(const char* str, size_t size) -> size_t
+{
+    return skip_whitespace_back_from(str, size);
+}
+
+/**
+ * @brief Skips whole blocks of whitespace, with `mask` giving the whitespace bits of a block.
+ */
+template <typename WhitespaceMask>
+auto skip_whitespace_blocks(const char* str, size_t size, WhitespaceMask&& mask) -> size_t
+{
+    size_t offset = 0;
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+    {
+        const uint64_t other = ~mask(str + offset); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (other != 0)
+        {
+            return offset + static_cast<size_t>(std::countr_zero(other));
+        }
+    }
+    return skip_whitespace_from(str, size, offset);
+}
+
+/**
+ * @brief Skips whole blocks of whitespace from the back, with `mask` giving the whitespace bits of a block.
+ */
+template <typename WhitespaceMask>
+auto skip_whitespace_back_blocks(const char* str, size_t size, WhitespaceMask&& mask) -> size_t
+{
+    size_t end = size;
+    for (; end >= BLOCK_SIZE; end -= BLOCK_SIZE)
+    {
+        const uint64_t other = ~mask(str + end - BLOCK_SIZE); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (other != 0)
+        {
+            return end - static_cast<size_t>(std::countl_zero(other));
+        }
+    }
+    return skip_whitespace_back_from(str, end);
+}
+
+/**
+ * @brief Closes a piece at every set bit of a block's delimiter mask.
+ *
+ * @param offset The offset of the block in the buffer.
+ * @param start Where the piece that is currently open started. Moved past every delimiter.
+ * @param count The number of pieces written to `out`.
+ *
+ * @return False if `out` filled up before every piece in the block was written.
+ */
+auto emit_pieces(const char* buf,
+                 size_t offset,
+                 uint64_t mask,
+                 size_t& start,
+                 std::span<std::string_view> out,
+                 size_t& count) -> bool
+{
+    for (; mask != 0; mask &= mask - 1)
+    {
+        if (count == out.size())
+        {
+            return false;
+        }
+        const size_t pos = offset + static_cast<size_t>(std::countr_zero(mask));
+        out[count++] = std::string_view(buf + start, pos - start); // NOLINT
+        start = pos + 1;
+    }
+    return true;
+}
+
+auto find_substring_scalar(const char* str, size_t size, std::string_view needle) -> size_t
+{
+    const size_t pos = std::string_view(str, size).find(needle);
+    return pos != std::string_view::npos ? pos : size;
+}
+
+/**
+ * @brief Splits the rest of a buffer on a multi-byte delimiter from `offset` onwards, for the tail that is too short
+ * for a whole block.
+ *
+ * @param start Where the piece that is currently open started.
+ * @param count The number of pieces already written to `out`.
+ */
+auto split_substring_from(const char* buf,
+                          size_t size,
+                          size_t start,
+                          size_t offset,
+                          std::string_view delim,
+                          std::span<std::string_view> out,
+                          size_t count) -> SplitResult
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    // An empty delimiter never closes a piece
+    offset = std::max(offset, start);
+    for (size_t pos = delim.empty() ? size : offset + find_substring_scalar(buf + offset, size - offset, delim);
+         pos < size;
+         pos = start + find_substring_scalar(buf + start, size - start, delim))
+    {
+        if (count == out.size())
+        {
+            return SplitResult{.count = count, .consumed = start};
+        }
+        out[count++] = std::string_view(buf + start, pos - start);
+        start = pos + delim.size();
+    }
+    if (start < size)
+    {
+        if (count == out.size())
+        {
+            return SplitResult{.count = count, .consumed = start};
+        }
+        out[count++] = std::string_view(buf + start, size - start);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return SplitResult{.count = count, .consumed = size};
+}
+
+auto split_substring_scalar(const char* buf, size_t size, std::string_view delim, std::span<std::string_view> out)
+    -> SplitResult
+{
+    return split_substring_from(buf, size, 0, 0, delim, out, 0);
+}
+
+/**
+ * @brief Splits the rest of a buffer on any of a set of delimiters from `offset` onwards, for the tail that is too
+ * short for a whole block.
+ *
+ * @param start Where the piece that is currently open started.
+ * @param count The number of pieces already written to `out`.
+ */
+auto split_any_from(const char* buf,
+                    size_t size,
+                    size_t start,
+                    size_t offset,
+                    std::string_view delims,
+                    std::span<std::string_view> out,
+                    size_t count) -> SplitResult
+{
+    const std::string_view text(buf, size);
+    for (size_t pos = text.find_first_of(delims, offset); pos != std::string_view::npos;
+         pos = text.find_first_of(delims, pos + 1))
+    {
+        if (count == out.size())
+        {
+            return SplitResult{.count = count, .consumed = start};
+        }
+        out[count++] = text.substr(start, pos - start);
+        start = pos + 1;
+    }
+    if (start < size)
+    {
+        if (count == out.size())
+        {
+            return SplitResult{.count = count, .consumed = start};
+        }
+        out[count++] = text.substr(start);
+    }
+    return SplitResult{.count = count, .consumed = size};
+}
+
+auto split_any_scalar(const char* buf, size_t size, std::string_view delims, std::span<std::string_view> out)
+    -> SplitResult
+{
+    return split_any_from(buf, size, 0, 0, delims, out, 0);
+}
+
+/**
+ * @brief Compares the bytes of a needle between its first and last, which a candidate is already known to match.
+ */
+auto matches_middle(const char* candidate, std::string_view needle) -> bool
+{
+    // Most delimiters are two bytes, which have no middle, so skip the call to memcmp for them
+    return needle.size() <= 2 || std::memcmp(candidate + 1, needle.data() + 1, needle.size() - 2) == 0; // NOLINT
+}
+
+/**
+ * @brief Finds a substring with whole blocks, for needles of two bytes or more.
+ *
+ * `pair_mask` gives the bits of a block where both the first byte of the needle matches, and the last byte matches
+ * `needle.size() - 1` bytes further on. Two bytes rule out almost every position, so the rest of the needle only has to
+ * be compared at the few candidates left, rather than at every occurrence of its first byte.
+ */
+template <typename PairMask>
+auto find_substring_blocks(const char* str, size_t size, std::string_view needle, PairMask&& pair_mask) -> size_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (needle.size() < 2)
+    {
+        return find_substring_scalar(str, size, needle);
+    }
+    size_t offset = 0;
+    for (; offset + BLOCK_SIZE + needle.size() - 1 <= size; offset += BLOCK_SIZE)
+    {
+        for (uint64_t mask = pair_mask(str + offset, needle); mask != 0; mask &= mask - 1)
+        {
+            const size_t pos = offset + static_cast<size_t>(std::countr_zero(mask));
+            if (matches_middle(str + pos, needle))
+            {
+                return pos;
+            }
+        }
+    }
+    return offset + find_substring_scalar(str + offset, size - offset, needle);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/**
+ * @brief Splits on a multi-byte delimiter with whole blocks, filtering candidates in the same way as
+ * `find_substring_blocks()`.
+ */
+template <typename PairMask>
+auto split_substring_blocks(const char* buf,
+                            size_t size,
+                            std::string_view delim,
+                            std::span<std::string_view> out,
+                            PairMask&& pair_mask) -> SplitResult
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (delim.size() < 2)
+    {
+        return split_substring_scalar(buf, size, delim, out);
+    }
+    size_t start = 0;
+    size_t offset = 0;
+    size_t count = 0;
+    for (; offset + BLOCK_SIZE + delim.size() - 1 <= size; offset += BLOCK_SIZE)
+    {
+        for (uint64_t mask = pair_mask(buf + offset, delim); mask != 0; mask &= mask - 1)
+        {
+            const size_t pos = offset + static_cast<size_t>(std::countr_zero(mask));
+            // Candidates inside the last delimiter found are skipped, so occurrences never overlap
+            if (pos < start || !matches_middle(buf + pos, delim))
+            {
+                continue;
+            }
+            if (count == out.size())
+            {
+                return SplitResult{.count = count, .consumed = start};
+            }
+            out[count++] = std::string_view(buf + start, pos - start);
+            start = pos + delim.size();
+        }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return split_substring_from(buf, size, start, offset, delim, out, count);
+}
+
+/**
+ * @brief Splits on any of a set of delimiters with whole blocks, with `any_mask` giving the bits of a block that match
+ * any of them.
+ */
+template <typename AnyMask>
+auto split_any_blocks(const char* buf,
+                      size_t size,
+                      std::string_view delims,
+                      std::span<std::string_view> out,
+                      AnyMask&& any_mask) -> SplitResult
+{
+    size_t start = 0;
+    size_t offset = 0;
+    size_t count = 0;
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+    {
+        if (!emit_pieces(buf, offset, any_mask(buf + offset, delims), start, out, count)) // NOLINT
+        {
+            return SplitResult{.count = count, .consumed = start};
+        }
+    }
+    return split_any_from(buf, size, start, offset, delims, out, count);
+}
+
+#if defined(DAEDALUS_ARCH_X86_64)
+// SSE2 is part of x86-64, so these need no target attribute or runtime check
+
+auto block_mask_sse2(const char* block, __m128i needle) -> uint64_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    uint64_t mask = 0;
+    for (size_t i = 0; i < BLOCK_SIZE; i += 16)
+    {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+        const auto bits = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, needle)));
+        mask |= static_cast<uint64_t>(bits) << i;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return mask;
+}
+
+auto find_sse2(const char* str, size_t size, char c) -> size_t
+{
+    const __m128i needle = _mm_set1_epi8(c);
+    size_t offset = 0;
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+    {
+        const uint64_t mask = block_mask_sse2(str + offset, needle); // NOLINT
+        if (mask != 0)
+        {
+            return offset + static_cast<size_t>(std::countr_zero(mask));
+        }
+    }
+    return offset + find_scalar(str + offset, size - offset, c); // NOLINT
+}
+
+auto count_sse2(const char* str, size_t size, char c) -> size_t
+{
+    const __m128i needle = _mm_set1_epi8(c);
+    size_t count = 0;
+    size_t offset = 0;
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+    {
+        count += static_cast<size_t>(std::popcount(block_mask_sse2(str + offset, needle))); // NOLINT
+    }
+    return count + count_scalar(str + offset, size - offset, c); // NOLINT
+}
+
+auto find_all_sse2(const char* str, size_t size, char c, size_t bias, std::span<size_t> out) -> size_t
+{
+    const __m128i needle = _mm_set1_epi8(c);
+    size_t count = 0;
+    size_t offset = 0;
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+    {
+        if (!emit_indices(bias + offset, block_mask_sse2(str + offset, needle), out, count)) // NOLINT
+        {
+            return count;
+        }
+    }
+    return find_all_from(str, size, offset, c, bias, out, count);
+}
+
+auto split_sse2(const char* buf, size_t size, char delim, std::span<std::string_view> out) -> SplitResult
+{
+    const __m128i needle = _mm_set1_epi8(delim);
+    size_t start = 0;
+    size_t offset = 0;
+    size_t count = 0;
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+    {
+        if (!emit_pieces(buf, offset, block_mask_sse2(buf + offset, needle), start, out, count)) // NOLINT
+        {
+            return SplitResult{.count = count, .consumed = start};
+        }
+    }
+    return split_from(buf, size, start, offset, delim, out, count);
+}
+
+auto classify_sse2(const char* block, char delim, char quote) -> BlockClasses
+{
+    return BlockClasses{
+        .quotes = block_mask_sse2(block, _mm_set1_epi8(quote)),
+        .delims = block_mask_sse2(block, _mm_set1_epi8(delim)),
+        .newlines = block_mask_sse2(block, _mm_set1_epi8('\n')),
+    };
+}
+
+/**
+ * @brief Finds the whitespace in a block. Subtracting '\t' moves '\t' to '\r' down to 0 to 4, and a byte is at most
+ * 4 exactly when taking its unsigned minimum with 4 leaves it as it is.
+ */
+auto whitespace_mask_sse2(const char* block) -> uint64_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i range = _mm_set1_epi8('\r' - '\t');
+    uint64_t mask = 0;
+    for (size_t i = 0; i < BLOCK_SIZE; i += 16)
+    {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+        const __m128i shifted = _mm_sub_epi8(bytes, tab);
+        const __m128i controls = _mm_cmpeq_epi8(_mm_min_epu8(shifted, range), shifted);
+        const __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(bytes, space), controls);
+        mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(matches))) << i;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return mask;
+}
+
+auto skip_whitespace_sse2(const char* str, size_t size) -> size_t
+{
+    return skip_whitespace_blocks(str, size, whitespace_mask_sse2);
+}
+
+auto skip_whitespace_back_sse2(const char* str, size_t size) -> size_t
+{
+    return skip_whitespace_back_blocks(str, size, whitespace_mask_sse2);
+}
+
+auto pair_mask_sse2(const char* block, std::string_view needle) -> uint64_t
+{
+    const uint64_t firsts = block_mask_sse2(block, _mm_set1_epi8(needle.front()));
+    return firsts & block_mask_sse2(block + needle.size() - 1, _mm_set1_epi8(needle.back())); // NOLINT
+}
+
+auto any_mask_sse2(const char* block, std::string_view delims) -> uint64_t
+{
+    uint64_t mask = 0;
+    for (char delim : delims)
+    {
+        mask |= block_mask_sse2(block, _mm_set1_epi8(delim));
+    }
+    return mask;
+}
+
+auto find_substring_sse2(const char* str, size_t size, std::string_view needle) -> size_t
+{
+    return find_substring_blocks(str, size, needle, pair_mask_sse2);
+}
+
+auto split_substring_sse2(const char* buf, size_t size, std::string_view delim, std::span<std::string_view> out)
+    -> SplitResult
+{
+    return split_substring_blocks(buf, size, delim, out, pair_mask_sse2);
+}
+
+auto split_any_sse2(const char* buf, size_t size, std::string_view delims, std::span<std::string_view> out)
+    -> SplitResult
+{
+    return split_any_blocks(buf, size, delims, out, any_mask_sse2);
+}
+
+DAEDALUS_ATTRIBUTE_TARGET("avx2")
+auto block_mask_avx2(const char* block, __m256i needle) -> uint64_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+    const auto low_bits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, needle)));
+    const auto high_bits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, needle)));
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return (static_cast<uint64_t>(high_bits) << 32) | low_bits;
+}
+
+DAEDALUS_ATTRIBUTE_TARGET("avx2")
+auto find_avx2(const char* str, size_t size, char c) -> size_t
+{
+    const __m256i needle = _mm256_set1_epi8(c);
+    size_t offset = 0;
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+    {
+        const uint64_t mask = block_mask_avx2(str + offset, needle); // NOLINT
+        if (mask != 0)
+        {
+            return offset + static_cast<size_t>(std::countr_zero(mask));
+        }
+    }
+    return offset + find_scalar(str + offset, size - offset, c); // NOLINT
+}
+
+DAEDALUS_ATTRIBUTE_TARGET("avx2")
+auto count_avx2(const char* str, size_t size, char c) -> size_t
+{
+    const __m256i needle = _mm256_set1_epi8(c);
+    size_t count = 0;
+    size_t offset = 0;
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+    {
+        count += static_cast<size_t>(std::popcount(block_mask_avx2(str + offset, needle))); // NOLINT
+    }
+    return count + count_scalar(str + offset, size - offset, c); // NOLINT
+}
+
+DAEDALUS_ATTRIBUTE_TARGET("avx2")
+auto find_all_avx2(const char* str, size_t size, char c, size_t bias, std::span<size_t> out) -> size_t
+{
+    const __m256i needle = _mm256_set1_epi8(c);
+    size_t count = 0;
+    size_t offset = 0;
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+    {
+        if (!emit_indices(bias + offset, block_mask_avx2(str + offset, needle), out, count)) // NOLINT
+        {
+            return count;
+        }
+    }
+    return find_all_from(str, size, offset, c, bias, out, count);
+}
+
+DAEDALUS_ATTRIBUTE_TARGET("avx2")
+auto split_avx2(const char* buf, size_t size, char delim, std::span<std::string_view> out) -> SplitResult
+{
+    const __m256i needle = _mm256_set1_epi8(delim);
+    size_t start = 0;
+    size_t offset = 0;
+    size_t count = 0;
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+    {
+        if (!emit_pieces(buf, offset, block_mask_avx2(buf + offset, needle), start, out, count)) // NOLINT
+        {
+            return SplitResult{.count = count, .consumed = start};
+        }
+    }
+    return split_from(buf, size, start, offset, delim, out, count);
+}
+
+DAEDALUS_ATTRIBUTE_TARGET("avx2")
+auto classify_avx2(const char* block, char delim, char quote) -> BlockClasses
+{
+    return BlockClasses{
+        .quotes = block_mask_avx2(block, _mm256_set1_epi8(quote)),
+        .delims = block_mask_avx2(block, _mm256_set1_epi8(delim)),
+        .newlines = block_mask_avx2(block, _mm256_set1_epi8('\n')),
+    };
+}
+/**
+ * @brief Finds the whitespace in a block, in the same way as `whitespace_mask_sse2()`.
+ */
+DAEDALUS_ATTRIBUTE_TARGET("avx2")
+auto whitespace_mask_avx2(const char* block) -> uint64_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i range = _mm256_set1_epi8('\r' - '\t');
+    uint64_t mask = 0;
+    for (size_t i = 0; i < BLOCK_SIZE; i += 32)
+    {
+        const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + i));
+        const __m256i shifted = _mm256_sub_epi8(bytes, tab);
+        const __m256i controls = _mm256_cmpeq_epi8(_mm256_min_epu8(shifted, range), shifted);
+        const __m256i matches = _mm256_or_si256(_mm256_cmpeq_epi8(bytes, space), controls);
+        mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(matches))) << i;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return mask;
+}
+
+DAEDALUS_ATTRIBUTE_TARGET("avx2")
+auto skip_whitespace_avx2(const char* str, size_t size) -> size_t
+{
+    return skip_whitespace_blocks(str, size, whitespace_mask_avx2);
+}
+
+DAEDALUS_ATTRIBUTE_TARGET("avx2")
+auto skip_whitespace_back_avx2(const char* str, size_t size) -> size_t
+{
+    return skip_whitespace_back_blocks(str, size, whitespace_mask_avx2);
+}
+
+DAEDALUS_ATTRIBUTE_TARGET("avx2")
+auto pair_mask_avx2(const char* block, std::string_view needle) -> uint64_t
+{
+    const uint64_t firsts = block_mask_avx2(block, _mm256_set1_epi8(needle.front()));
+    return firsts & block_mask_avx2(block + needle.size() - 1, _mm256_set1_epi8(needle.back())); // NOLINT
+}
+
+DAEDALUS_ATTRIBUTE_TARGET("avx2")
+auto any_mask_avx2(const char* block, std::string_view delims) -> uint64_t
+{
+    uint64_t mask = 0;
+    for (char delim : delims)
+    {
+        mask |= block_mask_avx2(block, _mm256_set1_epi8(delim));
+    }
+    return mask;
+}
+
+DAEDALUS_ATTRIBUTE_TARGET("avx2")
+auto find_substring_avx2(const char* str, size_t size, std::string_view needle) -> size_t
+{
+    return find_substring_blocks(str, size, needle, pair_mask_avx2);
+}
+
+DAEDALUS_ATTRIBUTE_TARGET("avx2")
+auto split_substring_avx2(const char* buf, size_t size, std::string_view delim, std::span<std::string_view> out)
+    -> SplitResult
+{
+    return split_substring_blocks(buf, size, delim, out, pair_mask_avx2);
+}
+
+DAEDALUS_ATTRIBUTE_TARGET("avx2")
+auto split_any_avx2(const char* buf, size_t size, std::string_view delims, std::span<std::string_view> out)
+    -> SplitResult
+{
+    return split_any_blocks(buf, size, delims, out, any_mask_avx2);
+}
+#elif defined(DAEDALUS_ARCH_ARM64)
+/**
+ * @brief NEON has no movemask, so the bits of four comparisons covering 64 bytes are built by weighting each byte by
+ * its position in its group of eight, and adding neighbouring bytes together until each group is one byte.
+ */
+auto movemask_neon(uint8x16_t eq0, uint8x16_t eq1, uint8x16_t eq2, uint8x16_t eq3) -> uint64_t
+{
+    static constexpr std::array<uint8_t, 16> WEIGHTS{1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    const uint8x16_t weights = vld1q_u8(WEIGHTS.data());
+    uint8x16_t sum = vpaddq_u8(vpaddq_u8(vandq_u8(eq0, weights), vandq_u8(eq1, weights)),
+                               vpaddq_u8(vandq_u8(eq2, weights), vandq_u8(eq3, weights)));
+    sum = vpaddq_u8(sum, sum);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sum), 0);
+}
+
+auto block_mask_neon(const char* block, uint8x16_t needle) -> uint64_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const auto* bytes = reinterpret_cast<const uint8_t*>(block);
+    return movemask_neon(vceqq_u8(vld1q_u8(bytes), needle),
+                         vceqq_u8(vld1q_u8(bytes + 16), needle),
+                         vceqq_u8(vld1q_u8(bytes + 32), needle),
+                         vceqq_u8(vld1q_u8(bytes + 48), needle));
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+auto find_neon(const char* str, size_t size, char c) -> size_t
+{
+    const uint8x16_t needle = vdupq_n_u8(static_cast<uint8_t>(c));
+    size_t offset = 0;
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+    {
+        const uint64_t mask = block_mask_neon(str + offset, needle); // NOLINT
+        if (mask != 0)
+        {
+            return offset + static_cast<size_t>(std::countr_zero(mask));
+        }
+    }
+    return offset + find_scalar(str + offset, size - offset, c); // NOLINT
+}
+
+auto count_neon(const char* str, size_t size, char c) -> size_t
+{
+    const uint8x16_t needle = vdupq_n_u8(static_cast<uint8_t>(c));
+    size_t count = 0;
+    size_t offset = 0;
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+    {
+        count += static_cast<size_t>(std::popcount(block_mask_neon(str + offset, needle))); // NOLINT
+    }
+    return count + count_scalar(str + offset, size - offset, c); // NOLINT
+}
+
+auto find_all_neon(const char* str, size_t size, char c, size_t bias, std::span<size_t> out) -> size_t
+{
+    const uint8x16_t needle = vdupq_n_u8(static_cast<uint8_t>(c));
+    size_t count = 0;
+    size_t offset = 0;
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+    {
+        if (!emit_indices(bias + offset, block_mask_neon(str + offset, needle), out, count)) // NOLINT
+        {
+            return count;
+        }
+    }
+    return find_all_from(str, size, offset, c, bias, out, count);
+}
+
+auto split_neon(const char* buf, size_t size, char delim, std::span<std::string_view> out) -> SplitResult
+{
+    const uint8x16_t needle = vdupq_n_u8(static_cast<uint8_t>(delim));
+    size_t start = 0;
+    size_t offset = 0;
+    size_t count = 0;
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+    {
+        if (!emit_pieces(buf, offset, block_mask_neon(buf + offset, needle), start, out, count)) // NOLINT
+        {
+            return SplitResult{.count = count, .consumed = start};
+        }
+    }
+    return split_from(buf, size, start, offset, delim, out, count);
+}
+
+auto classify_neon(const char* block, char delim, char quote) -> BlockClasses
+{
+    return BlockClasses{
+        .quotes = block_mask_neon(block, vdupq_n_u8(static_cast<uint8_t>(quote))),
+        .delims = block_mask_neon(block, vdupq_n_u8(static_cast<uint8_t>(delim))),
+        .newlines = block_mask_neon(block, vdupq_n_u8(static_cast<uint8_t>('\n'))),
+    };
+}
+
+/**
+ * @brief Finds the whitespace in 16 bytes. Subtracting '\t' moves '\t' to '\r' down to 0 to 4.
+ */
+auto whitespace_neon(const uint8_t* bytes) -> uint8x16_t
+{
+    const uint8x16_t chunk = vld1q_u8(bytes);
+    const uint8x16_t controls = vcleq_u8(vsubq_u8(chunk, vdupq_n_u8('\t')), vdupq_n_u8('\r' - '\t'));
+    return vorrq_u8(vceqq_u8(chunk, vdupq_n_u8(' ')), controls);
+}
+
+auto whitespace_mask_neon(const char* block) -> uint64_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const auto* bytes = reinterpret_cast<const uint8_t*>(block);
+    return movemask_neon(whitespace_neon(bytes),
+                         whitespace_neon(bytes + 16),
+                         whitespace_neon(bytes + 32),
+                         whitespace_neon(bytes + 48));
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+auto skip_whitespace_neon(const char* str, size_t size) -> size_t
+{
+    return skip_whitespace_blocks(str, size, whitespace_mask_neon);
+}
+
+auto skip_whitespace_back_neon(const char* str, size_t size) -> size_t
+{
+    return skip_whitespace_back_blocks(str, size, whitespace_mask_neon);
+}
+
+auto pair_mask_neon(const char* block, std::string_view needle) -> uint64_t
+{
+    const uint64_t firsts = block_mask_neon(block, vdupq_n_u8(static_cast<uint8_t>(needle.front())));
+    const uint8x16_t last = vdupq_n_u8(static_cast<uint8_t>(needle.back()));
+    return firsts & block_mask_neon(block + needle.size() - 1, last); // NOLINT
+}
+
+/**
+ * @brief Finds the bytes of a block that match any of a set of delimiters. The comparisons are combined before the
+ * bits are built, as building them is the expensive part on NEON.
+ */
+auto any_mask_neon(const char* block, std::string_view delims) -> uint64_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const auto* bytes = reinterpret_cast<const uint8_t*>(block);
+    const std::array<uint8x16_t, 4> chunks{
+        vld1q_u8(bytes),
+        vld1q_u8(bytes + 16),
+        vld1q_u8(bytes + 32),
+        vld1q_u8(bytes + 48),
+    };
+    std::array<uint8x16_t, 4> matches{vdupq_n_u8(0), vdupq_n_u8(0), vdupq_n_u8(0), vdupq_n_u8(0)};
+    for (char delim : delims)
+    {
+        const uint8x16_t needle = vdupq_n_u8(static_cast<uint8_t>(delim));
+        for (size_t i = 0; i < chunks.size(); i++)
+        {
+            matches[i] = vorrq_u8(matches[i], vceqq_u8(chunks[i], needle));
+        }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return movemask_neon(matches[0], matches[1], matches[2], matches[3]);
+}
+
+auto find_substring_neon(const char* str, size_t size, std::string_view needle) -> size_t
+{
+    return find_substring_blocks(str, size, needle, pair_mask_neon);
+}
+
+auto split_substring_neon(const char* buf, size_t size, std::string_view delim, std::span<std::string_view> out)
+    -> SplitResult
+{
+    return split_substring_blocks(buf, size, delim, out, pair_mask_neon);
+}
+
+auto split_any_neon(const char* buf, size_t size, std::string_view delims, std::span<std::string_view> out)
+    -> SplitResult
+{
+    return split_any_blocks(buf, size, delims, out, any_mask_neon);
+}
+#endif
+
+constexpr KernelSet SCALAR_KERNELS{
+    .name = "scalar",
+    .find = find_scalar,
+    .count = count_scalar,
+    .find_all = find_all_scalar,
+    .split = split_scalar,
+    .classify = classify_scalar,
+    .skip_whitespace = skip_whitespace_scalar,
+    .skip_whitespace_back = skip_whitespace_back_scalar,
+    .find_substring = find_substring_scalar,
+    .split_substring = split_substring_scalar,
+    .split_any = split_any_scalar,
+};
+
+#if defined(DAEDALUS_ARCH_X86_64)
+constexpr KernelSet SSE2_KERNELS{
+    .name = "sse2",
+    .find = find_sse2,
+    .count = count_sse2,
+    .find_all = find_all_sse2,
+    .split = split_sse2,
+    .classify = classify_sse2,
+    .skip_whitespace = skip_whitespace_sse2,
+    .skip_whitespace_back = skip_whitespace_back_sse2,
+    .find_substring = find_substring_sse2,
+    .split_substring = split_substring_sse2,
+    .split_any = split_any_sse2,
+};
+
+constexpr KernelSet AVX2_KERNELS{
+    .name = "avx2",
+    .find = find_avx2,
+    .count = count_avx2,
+    .find_all = find_all_avx2,
+    .split = split_avx2,
+    .classify = classify_avx2,
+    .skip_whitespace = skip_whitespace_avx2,
+    .skip_whitespace_back = skip_whitespace_back_avx2,
+    .find_substring = find_substring_avx2,
+    .split_substring = split_substring_avx2,
+    .split_any = split_any_avx2,
+};
+#elif defined(DAEDALUS_ARCH_ARM64)
+constexpr KernelSet NEON_KERNELS{
+    .name = "neon",
+    .find = find_neon,
+    .count = count_neon,
+    .find_all = find_all_neon,
+    .split = split_neon,
+    .classify = classify_neon,
+    .skip_whitespace = skip_whitespace_neon,
+    .skip_whitespace_back = skip_whitespace_back_neon,
+    .find_substring = find_substring_neon,
+    .split_substring = split_substring_neon,
+    .split_any = split_any_neon,
+};
+#endif
+} // namespace
+
+auto get_kernels() -> const KernelSet&
+{
+    static const KernelSet kernels = get_supported_kernels().back();
+    return kernels;
+}
+
+auto get_supported_kernels() -> std::vector<KernelSet>
+{
+    std::vector<KernelSet> kernels{SCALAR_KERNELS};
+#if defined(DAEDALUS_ARCH_X86_64)
+    kernels.push_back(SSE2_KERNELS);
+    if (get_cpu_features().avx2)
+    {
+        kernels.push_back(AVX2_KERNELS);
+    }
+#elif defined(DAEDALUS_ARCH_ARM64)
+    if (get_cpu_features().neon)
+    {
+        kernels.push_back(NEON_KERNELS);
+    }
+#endif
+    return kernels;
+}
+
+} // namespace dae::strings::kernels
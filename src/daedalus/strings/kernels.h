@@ -0,0 +1,130 @@
+#ifndef DAEDALUS_STRINGS_KERNELS_H
+#define DAEDALUS_STRINGS_KERNELS_H
+
+#include "daedalus/strings/utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace dae::strings::kernels
+{
+
+/**
+ * @brief Finds the first occurrence of a character.
+ *
+ * @return The index of the character, or `size` if it does not occur.
+ */
+using FindFunction = auto (*)(const char* str, size_t size, char c) -> size_t;
+
+/**
+ * @brief Counts the occurrences of a character.
+ */
+using CountFunction = auto (*)(const char* str, size_t size, char c) -> size_t;
+
+/**
+ * @brief Finds every occurrence of a character, writing `bias` plus the index of each into `out` in order.
+ *
+ * @return The number of indices written. Stops early if `out` fills up.
+ */
+using FindAllFunction = auto (*)(const char* str, size_t size, char c, size_t bias, std::span<size_t> out) -> size_t;
+
+/**
+ * @brief Checks if a character is ASCII whitespace: ' ', '\t', '\n', '\v', '\f', or '\r'.
+ */
+[[nodiscard]] constexpr auto is_whitespace(char c) -> bool
+{
+    // '\t' to '\r' are the five consecutive codes 9 to 13, so one unsigned compare covers all of them
+    return c == ' ' || static_cast<unsigned char>(c - '\t') <= '\r' - '\t';
+}
+
+/**
+ * @brief Skips the ASCII whitespace at the front of a string, as defined by `is_whitespace()`.
+ *
+ * @return The index of the first character that is not whitespace, or `size` if they all are.
+ */
+using SkipWhitespaceFunction = auto (*)(const char* str, size_t size) -> size_t;
+
+/**
+ * @brief Skips the ASCII whitespace at the back of a string, as defined by `is_whitespace()`.
+ *
+ * @return One past the index of the last character that is not whitespace, or 0 if they all are.
+ */
+using SkipWhitespaceBackFunction = auto (*)(const char* str, size_t size) -> size_t;
+
+/**
+ * @brief The structural characters of delimited text in a block of 64 bytes, with one bit per byte.
+ */
+struct BlockClasses
+{
+    uint64_t quotes{0};
+    uint64_t delims{0};
+    uint64_t newlines{0};
+};
+
+/**
+ * @brief Classifies a block of exactly 64 bytes, finding every quote, delimiter, and '\n'.
+ */
+using ClassifyFunction = auto (*)(const char* block, char delim, char quote) -> BlockClasses;
+
+/**
+ * @brief Splits a buffer on a delimiter into `out`, with the same rules as `daedalus::strings::split_into()`.
+ */
+using SplitFunction = auto (*)(const char* buf, size_t size, char delim, std::span<std::string_view> out)
+    -> SplitResult;
+
+/**
+ * @brief Finds the first occurrence of a substring.
+ *
+ * @return The index of the substring, or `size` if it does not occur. An empty needle is found at 0.
+ */
+using FindSubstringFunction = auto (*)(const char* str, size_t size, std::string_view needle) -> size_t;
+
+/**
+ * @brief Splits a buffer on a multi-byte delimiter into `out`, with the same rules as
+ * `daedalus::strings::split_into()`. Occurrences are matched from left to right and never overlap.
+ */
+using SplitSubstringFunction =
+    auto (*)(const char* buf, size_t size, std::string_view delim, std::span<std::string_view> out) -> SplitResult;
+
+/**
+ * @brief Splits a buffer on any of a set of single byte delimiters into `out`, with the same rules as
+ * `daedalus::strings::split_into()`.
+ */
+using SplitAnyFunction =
+    auto (*)(const char* buf, size_t size, std::string_view delims, std::span<std::string_view> out) -> SplitResult;
+
+/**
+ * @brief One implementation of every kernel, for one instruction set.
+ */
+struct KernelSet
+{
+    const char* name;
+    FindFunction find;
+    CountFunction count;
+    FindAllFunction find_all;
+    SplitFunction split;
+    ClassifyFunction classify;
+    SkipWhitespaceFunction skip_whitespace;
+    SkipWhitespaceBackFunction skip_whitespace_back;
+    FindSubstringFunction find_substring;
+    SplitSubstringFunction split_substring;
+    SplitAnyFunction split_any;
+};
+
+/**
+ * @brief Gets the fastest kernels the CPU supports, chosen with `dae::get_cpu_features()` on the first call.
+ */
+[[nodiscard]] auto get_kernels() -> const KernelSet&;
+
+/**
+ * @brief Gets every set of kernels the CPU supports, slowest first, starting with the portable scalar set. Meant for
+ * benchmarking and testing the sets against each other.
+ */
+[[nodiscard]] auto get_supported_kernels() -> std::vector<KernelSet>;
+
+} // namespace dae::strings::kernels
+
+#endif
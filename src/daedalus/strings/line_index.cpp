@@ -0,0 +1,134 @@
+#include "daedalus/strings/line_index.h"
+
+#include "daedalus/strings/kernels.h"
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dae::strings
+{
+
+namespace
+{
+// Chunks start on a block boundary, so that no vector kernel straddles two threads' chunks
+constexpr size_t CHUNK_ALIGNMENT = 64;
+
+/**
+ * @brief Runs `work(chunk)` for every chunk, each on its own thread. The calling thread takes the first chunk, rather
+ * than sitting idle.
+ */
+template <typename Work>
+auto for_each_chunk(size_t chunk_count, Work&& work) -> void
+{
+    std::vector<std::thread> threads;
+    threads.reserve(chunk_count - 1);
+    for (size_t chunk = 1; chunk < chunk_count; chunk++)
+    {
+        threads.emplace_back(work, chunk);
+    }
+    work(0);
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+} // namespace
+
+LineIndex::LineIndex(std::string_view text, const LineIndexOptions& options) : text(text)
+{
+    if (text.empty())
+    {
+        return;
+    }
+
+    const size_t hardware_threads = std::max(std::thread::hardware_concurrency(), 1U);
+    const size_t max_threads = options.thread_count == 0 ? hardware_threads : options.thread_count;
+    const size_t worthwhile_chunks = std::max<size_t>(text.size() / std::max<size_t>(options.min_chunk_size, 1), 1);
+    const size_t target_chunks = std::min(max_threads, worthwhile_chunks);
+
+    size_t chunk_size = (text.size() + target_chunks - 1) / target_chunks;
+    chunk_size = (chunk_size + CHUNK_ALIGNMENT - 1) / CHUNK_ALIGNMENT * CHUNK_ALIGNMENT;
+    const size_t chunk_count = (text.size() + chunk_size - 1) / chunk_size;
+
+    const kernels::KernelSet& kernel_set = kernels::get_kernels();
+    auto chunk_begin = [&](size_t chunk) -> size_t { return chunk * chunk_size; };
+    auto chunk_length = [&](size_t chunk) -> size_t { return std::min(chunk_size, text.size() - chunk_begin(chunk)); };
+
+    // First pass counts each chunk's delimiters, so every chunk knows where its lines go in the array
+    std::vector<size_t> first_delim(chunk_count + 1, 0);
+    for_each_chunk(chunk_count, [&](size_t chunk) -> void {
+        first_delim[chunk + 1] =
+            kernel_set.count(text.data() + chunk_begin(chunk), chunk_length(chunk), options.delim); // NOLINT
+    });
+    for (size_t chunk = 0; chunk < chunk_count; chunk++)
+    {
+        first_delim[chunk + 1] += first_delim[chunk];
+    }
+
+    const size_t delim_count = first_delim[chunk_count];
+    const bool ends_with_delim = text.back() == options.delim;
+    line_count = delim_count + (ends_with_delim ? 0 : 1);
+
+    // Left uninitialized, so the pages are first touched by the threads that fill them
+    offsets_array = std::make_unique_for_overwrite<size_t[]>(line_count + 1); // NOLINT
+    offsets_array[0] = 0;
+    if (!ends_with_delim)
+    {
+        offsets_array[line_count] = text.size() + 1;
+    }
+
+    // Second pass writes one past every delimiter, which is the start of the next line
+    for_each_chunk(chunk_count, [&](size_t chunk) -> void {
+        const size_t begin = chunk_begin(chunk);
+        const size_t first = first_delim[chunk];
+        const std::span<size_t> out(&offsets_array[1 + first], first_delim[chunk + 1] - first);
+        kernel_set.find_all(text.data() + begin, chunk_length(chunk), options.delim, begin + 1, out); // NOLINT
+    });
+}
+
+LineIndex::LineIndex(LineIndex&& other) noexcept
+    : text(std::exchange(other.text, {})),
+      line_count(std::exchange(other.line_count, 0)),
+      offsets_array(std::move(other.offsets_array))
+{
+}
+
+auto LineIndex::operator=(LineIndex&& other) noexcept -> LineIndex&
+{
+    text = std::exchange(other.text, {});
+    line_count = std::exchange(other.line_count, 0);
+    offsets_array = std::move(other.offsets_array);
+    return *this;
+}
+
+auto LineIndex::at(size_t line) const -> std::optional<std::string_view>
+{
+    if (line >= line_count)
+    {
+        return std::nullopt;
+    }
+    return (*this)[line];
+}
+
+auto LineIndex::line_of(size_t offset) const -> std::optional<size_t>
+{
+    if (offset >= text.size())
+    {
+        return std::nullopt;
+    }
+    const std::span<const size_t> starts = offsets();
+    return static_cast<size_t>(std::ranges::upper_bound(starts, offset) - starts.begin()) - 1;
+}
+
+auto LineIndex::offsets() const -> std::span<const size_t>
+{
+    if (!offsets_array)
+    {
+        return {};
+    }
+    return {offsets_array.get(), line_count + 1};
+}
+
+} // namespace dae::strings
@@ -0,0 +1,125 @@
+#ifndef DAEDALUS_STRINGS_LINE_INDEX_H
+#define DAEDALUS_STRINGS_LINE_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace dae::strings
+{
+
+/**
+ * @brief Settings for building a LineIndex.
+ */
+struct LineIndexOptions
+{
+    char delim{'\n'};
+    /**
+     * @brief The most threads to index with, including the calling thread. 0 uses every hardware thread.
+     */
+    uint32_t thread_count{0};
+    /**
+     * @brief The smallest part of the text worth giving to its own thread. Text smaller than this is indexed on the
+     * calling thread alone.
+     */
+    size_t min_chunk_size{static_cast<size_t>(4) * 1024 * 1024};
+};
+
+/**
+ * @brief An index of where every line in a text buffer starts, so that any line can be reached in O(1). Lines follow
+ * the same rules as `split()`.
+ *
+ * The index is built in parallel. The text is cut into one chunk per thread, and each thread counts the delimiters in
+ * its chunk with the string kernels. A prefix sum of the counts gives each chunk the number of its first line, and
+ * then each thread writes the starts of its lines into its own part of one contiguous array.
+ *
+ * @note The index views the text, so the text must be kept alive while the index or its lines are in use.
+ */
+class LineIndex
+{
+  public:
+    LineIndex() = default;
+
+    /**
+     * @param text The text to index.
+     * @param options How to index the text.
+     */
+    explicit LineIndex(std::string_view text, const LineIndexOptions& options = {});
+    ~LineIndex() = default;
+
+    LineIndex(const LineIndex& other) = delete;
+    auto operator=(const LineIndex& other) -> LineIndex& = delete;
+    LineIndex(LineIndex&& other) noexcept;
+    auto operator=(LineIndex&& other) noexcept -> LineIndex&;
+
+    /**
+     * @brief Gets the number of lines.
+     */
+    [[nodiscard]] auto size() const -> size_t
+    {
+        return line_count;
+    }
+
+    [[nodiscard]] auto empty() const -> bool
+    {
+        return line_count == 0;
+    }
+
+    /**
+     * @brief Gets a line, without checking that it exists.
+     *
+     * @param line The number of the line, from 0.
+     */
+    [[nodiscard]] auto operator[](size_t line) const -> std::string_view
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return text.substr(offsets_array[line], offsets_array[line + 1] - offsets_array[line] - 1);
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    /**
+     * @brief Gets a line.
+     *
+     * @param line The number of the line, from 0.
+     *
+     * @return The line, or std::nullopt if there are not that many lines.
+     */
+    [[nodiscard]] auto at(size_t line) const -> std::optional<std::string_view>;
+
+    /**
+     * @brief Finds the line that a byte of the text is on, with a binary search of the offsets. A delimiter is on the
+     * line it ends.
+     *
+     * @param offset The offset of the byte in the text.
+     *
+     * @return The number of the line, or std::nullopt if the offset is past the last line.
+     */
+    [[nodiscard]] auto line_of(size_t offset) const -> std::optional<size_t>;
+
+    /**
+     * @brief Gets the offset of the start of every line, followed by one entry past the delimiter of the last line, as
+     * if the text always ended with a delimiter. Line `n` runs from `offsets()[n]` up to `offsets()[n + 1] - 1`.
+     */
+    [[nodiscard]] auto offsets() const -> std::span<const size_t>;
+
+    /**
+     * @brief Gets the text that was indexed.
+     */
+    [[nodiscard]] auto get_text() const -> std::string_view
+    {
+        return text;
+    }
+
+  private:
+    std::string_view text;
+    size_t line_count{0};
+    // line_count + 1 entries, left uninitialized until the indexing threads write them
+    std::unique_ptr<size_t[]> offsets_array; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+};
+
+} // namespace dae::strings
+
+#endif
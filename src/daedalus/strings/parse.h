@@ -0,0 +1,217 @@
+#ifndef DAEDALUS_STRINGS_PARSE_H
+#define DAEDALUS_STRINGS_PARSE_H
+
+#include "daedalus/math/concepts.h"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+namespace dae::strings
+{
+
+/**
+ * @brief Any number type that `std::from_chars()` can parse.
+ */
+template <typename T>
+concept Parseable = Numeric<T> && !std::same_as<T, bool>;
+
+/**
+ * @brief The outcome of a call to `parse_column()`.
+ */
+struct ParseColumnResult
+{
+    /**
+     * @brief The number of fields parsed. If a field failed to parse, this is its index.
+     */
+    size_t count{0};
+    /**
+     * @brief Why the field at `count` failed to parse, or `std::errc()` if every field parsed.
+     */
+    std::errc error{};
+};
+
+namespace swar
+{
+constexpr uint64_t ASCII_ZEROS = 0x3030'3030'3030'3030;
+
+/**
+ * @brief Loads 1 to 8 digits into a word, padded in front with '0's, so the last digit is always in the top byte.
+ */
+inline auto load_digits(const char* str, size_t size) -> uint64_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (size >= 4)
+    {
+        // Two fixed size loads that overlap in the middle, rather than a call to memcpy with a size only known at
+        // runtime
+        uint32_t first = 0;
+        uint32_t last = 0;
+        std::memcpy(&first, str, sizeof(first));
+        std::memcpy(&last, str + size - sizeof(last), sizeof(last));
+        const size_t padding_bits = (8 - size) * 8;
+        const uint64_t padding = padding_bits == 0 ? 0 : ASCII_ZEROS >> (64 - padding_bits);
+        return (static_cast<uint64_t>(first) << padding_bits) | (static_cast<uint64_t>(last) << 32) | padding;
+    }
+    uint64_t bytes = ASCII_ZEROS;
+    for (size_t i = 0; i < size; i++)
+    {
+        bytes = (bytes >> 8) | (static_cast<uint64_t>(static_cast<uint8_t>(str[i])) << 56);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return bytes;
+}
+
+/**
+ * @brief Checks that all 8 bytes of a word are ASCII digits. A digit has a high nibble of 3, and stays below 0x40 when
+ * 6 is added to it.
+ */
+inline auto all_digits(uint64_t bytes) -> bool
+{
+    constexpr uint64_t HIGH_NIBBLES = 0xF0F0'F0F0'F0F0'F0F0;
+    constexpr uint64_t SIXES = 0x0606'0606'0606'0606;
+    constexpr uint64_t THREES = 0x3333'3333'3333'3333;
+    return ((bytes & HIGH_NIBBLES) | (((bytes + SIXES) & HIGH_NIBBLES) >> 4)) == THREES;
+}
+
+/**
+ * @brief Converts 8 ASCII digits in a word to their value, with the first digit in the bottom byte. Neighbouring
+ * digits are combined into pairs, then quads, then the whole word, with one multiply each.
+ */
+inline auto eight_digits(uint64_t bytes) -> uint64_t
+{
+    bytes = ((bytes & 0x0F0F'0F0F'0F0F'0F0F) * ((10 << 8) + 1)) >> 8;
+    bytes = ((bytes & 0x00FF'00FF'00FF'00FF) * ((100 << 16) + 1)) >> 16;
+    return ((bytes & 0x0000'FFFF'0000'FFFF) * ((10'000ULL << 32) + 1)) >> 32;
+}
+
+/**
+ * @brief Parses 1 to 16 ASCII digits, eight at a time.
+ *
+ * @return The value, or std::nullopt if any of the characters is not a digit.
+ */
+inline auto parse_digits(const char* str, size_t size) -> std::optional<uint64_t>
+{
+    constexpr size_t WORD_DIGITS = 8;
+    constexpr uint64_t WORD_SCALE = 100'000'000;
+    if (size <= WORD_DIGITS)
+    {
+        const uint64_t bytes = load_digits(str, size);
+        return all_digits(bytes) ? std::optional<uint64_t>(eight_digits(bytes)) : std::nullopt;
+    }
+    const uint64_t high = load_digits(str, size - WORD_DIGITS);
+    const uint64_t low = load_digits(str + size - WORD_DIGITS, WORD_DIGITS); // NOLINT
+    if (!all_digits(high) || !all_digits(low))
+    {
+        return std::nullopt;
+    }
+    return (eight_digits(high) * WORD_SCALE) + eight_digits(low);
+}
+} // namespace swar
+
+/**
+ * @brief Parses a whole string as a number, without allocating, copying, or depending on the locale.
+ *
+ * @note Follows the rules of `std::from_chars()`: no leading whitespace, no '+' sign, and no base prefixes. Unlike
+ * `std::from_chars()` the whole string must be the number. Integers of up to 16 digits are parsed eight digits at a
+ * time within one 64-bit word, which is what makes fixed-width columns such as IDs, dates, and timestamps fast.
+ *
+ * @param sv The string to parse.
+ * @param value Where to write the number. Left as it is if parsing fails.
+ *
+ * @return `std::errc()` on success, `std::errc::invalid_argument` if the string is not a number of type T, or
+ * `std::errc::result_out_of_range` if the number does not fit in T.
+ */
+template <Parseable T>
+[[nodiscard]] auto parse(std::string_view sv, T& value) -> std::errc
+{
+    if constexpr (std::integral<T> && std::endian::native == std::endian::little)
+    {
+        constexpr size_t MAX_FAST_DIGITS = 16;
+        const bool negative = std::signed_integral<T> && !sv.empty() && sv.front() == '-';
+        const std::string_view digits = negative ? sv.substr(1) : sv;
+        if (!digits.empty() && digits.size() <= MAX_FAST_DIGITS)
+        {
+            const std::optional<uint64_t> magnitude = swar::parse_digits(digits.data(), digits.size());
+            if (magnitude)
+            {
+                using Unsigned = std::make_unsigned_t<T>;
+                const auto max = static_cast<uint64_t>(std::numeric_limits<T>::max());
+                if (magnitude.value() > max + (negative ? 1 : 0))
+                {
+                    return std::errc::result_out_of_range;
+                }
+                const auto bits = static_cast<Unsigned>(magnitude.value());
+                value = static_cast<T>(negative ? static_cast<Unsigned>(Unsigned{0} - bits) : bits);
+                return std::errc();
+            }
+        }
+    }
+
+    const char* end = sv.data() + sv.size(); // NOLINT
+    T parsed{};
+    const std::from_chars_result result = std::from_chars(sv.data(), end, parsed);
+    if (result.ec != std::errc())
+    {
+        return result.ec;
+    }
+    if (result.ptr != end)
+    {
+        return std::errc::invalid_argument;
+    }
+    value = parsed;
+    return std::errc();
+}
+
+/**
+ * @brief Parses a whole string as a number, with the same rules as `parse(sv, value)`.
+ *
+ * @return The number, or std::nullopt if the string is not a number of type T or it does not fit.
+ */
+template <Parseable T>
+[[nodiscard]] auto parse(std::string_view sv) -> std::optional<T>
+{
+    T value{};
+    if (parse(sv, value) != std::errc())
+    {
+        return std::nullopt;
+    }
+    return value;
+}
+
+/**
+ * @brief Parses a column of fields, such as one column of a CSV file, into an array of numbers.
+ *
+ * @note Stops at the first field that fails to parse, so its index and the reason can be reported.
+ *
+ * @param fields The fields to parse.
+ * @param out Where to write the numbers. Only the first `min(fields.size(), out.size())` fields are parsed.
+ *
+ * @return How many fields were parsed, and why the next one failed if any did.
+ */
+template <Parseable T>
+auto parse_column(std::span<const std::string_view> fields, std::span<T> out) -> ParseColumnResult
+{
+    const size_t count = std::min(fields.size(), out.size());
+    for (size_t i = 0; i < count; i++)
+    {
+        const std::errc error = parse(fields[i], out[i]);
+        if (error != std::errc())
+        {
+            return ParseColumnResult{.count = i, .error = error};
+        }
+    }
+    return ParseColumnResult{.count = count, .error = std::errc()};
+}
+
+} // namespace dae::strings
+
+#endif
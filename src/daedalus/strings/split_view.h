@@ -0,0 +1,180 @@
+#ifndef DAEDALUS_STRINGS_SPLIT_VIEW_H
+#define DAEDALUS_STRINGS_SPLIT_VIEW_H
+
+#include "daedalus/containers/stack_array.h"
+#include "daedalus/strings/kernels.h"
+#include "daedalus/strings/utils.h"
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+
+namespace dae::strings
+{
+
+/**
+ * @brief A lazy view of the pieces of a char buffer split on a delimiter, with the same rules as `split()`. Each piece
+ * is found as the iterator reaches it, so nothing is allocated and iteration can stop early without scanning the rest
+ * of the buffer.
+ *
+ * @note The string_views are views of the passed in buffer, so the buffer must be kept alive while the view, its
+ * iterators, or the string_views are in use.
+ */
+class split_view : public std::ranges::view_interface<split_view>
+{
+  public:
+    class iterator
+    {
+      public:
+        using iterator_concept = std::forward_iterator_tag;
+        // operator* returns by value, which only meets the requirements of a legacy input iterator
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        [[nodiscard]] auto operator*() const -> std::string_view
+        {
+            return piece;
+        }
+
+        auto operator++() -> iterator&
+        {
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const char* after = piece.data() + piece.size();
+            if (end - after <= 1)
+            {
+                // Either there was no delimiter after this piece, or it was the last character of the buffer
+                piece = std::string_view(end, 0);
+                return *this;
+            }
+            const size_t remaining = static_cast<size_t>(end - after) - 1;
+            piece = std::string_view(after + 1, find(after + 1, remaining, delim));
+            // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return *this;
+        }
+
+        auto operator++(int) -> iterator
+        {
+            iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        [[nodiscard]] auto operator==(const iterator& other) const -> bool
+        {
+            return piece.data() == other.piece.data();
+        }
+
+      private:
+        friend class split_view;
+
+        iterator(std::string_view piece, const char* end, char delim, kernels::FindFunction find)
+            : piece(piece), end(end), delim(delim), find(find)
+        {
+        }
+
+        std::string_view piece;
+        const char* end{nullptr};
+        char delim{'\0'};
+        kernels::FindFunction find{nullptr};
+    };
+
+    split_view() = default;
+
+    /**
+     * @param buf A character buffer to split.
+     * @param size The size of the character buffer.
+     * @param delim The delimiter to split the character buffer with.
+     */
+    split_view(const char* buf, size_t size, char delim) : buf(buf), size(size), delim(delim)
+    {
+    }
+
+    /**
+     * @param sv The string to split.
+     * @param delim The delimiter to split the string with.
+     */
+    split_view(std::string_view sv, char delim) : buf(sv.data()), size(sv.size()), delim(delim)
+    {
+    }
+
+    /**
+     * @brief Gets an iterator to the first piece, searching the buffer up to the first delimiter.
+     */
+    [[nodiscard]] auto begin() const -> iterator
+    {
+        if (size == 0)
+        {
+            return end();
+        }
+        const kernels::FindFunction find = kernels::get_kernels().find;
+        return {std::string_view(buf, find(buf, size, delim)), buf + size, delim, find}; // NOLINT
+    }
+
+    [[nodiscard]] auto end() const -> iterator
+    {
+        const char* back = buf + size; // NOLINT
+        return {std::string_view(back, 0), back, delim, nullptr};
+    }
+
+  private:
+    const char* buf{nullptr};
+    size_t size{0};
+    char delim{'\0'};
+};
+
+/**
+ * @brief Lazily splits a string into lines on '\n'.
+ *
+ * @note A '\r' before the '\n' is kept at the end of the line. Pass the lines through `trim()` if that matters.
+ *
+ * @param sv The string to split into lines.
+ *
+ * @return A split_view over the lines of the string.
+ */
+[[nodiscard]] inline auto lines(std::string_view sv) -> split_view
+{
+    return {sv, '\n'};
+}
+
+/**
+ * @brief Splits a char buffer into a stack_array, with the same rules as `split()`, without allocating.
+ *
+ * @note If the array fills up before the end of the buffer, the split stops there. Calling it again with
+ * `buf + consumed` and `size - consumed` carries on with the next piece.
+ *
+ * @param buf A character buffer to split.
+ * @param size The size of the character buffer.
+ * @param delim The delimiter to split the character buffer with.
+ * @param out Where to write the string_views of the pieces, starting from index 0.
+ *
+ * @return How many pieces were written, and how much of the buffer they covered.
+ */
+template <size_t Capacity, ManagementMode MMode, auto... ValsForDefaultT>
+auto split_into(const char* buf,
+                size_t size,
+                char delim,
+                stack_array_impl<std::string_view, Capacity, MMode, ValsForDefaultT...>& out) -> SplitResult
+{
+    SplitResult result{.count = 0, .consumed = size};
+    for (std::string_view piece : split_view(buf, size, delim))
+    {
+        if (result.count == Capacity)
+        {
+            result.consumed = static_cast<size_t>(piece.data() - buf);
+            break;
+        }
+        out.copy_to(result.count++, piece);
+    }
+    return result;
+}
+
+} // namespace dae::strings
+
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<dae::strings::split_view> = true;
+
+#endif
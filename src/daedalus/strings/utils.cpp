@@ -1,7 +1,9 @@
 #include "daedalus/strings/utils.h"
 
+#include "daedalus/strings/kernels.h"
+
 #include <algorithm>
-#include <cctype>
+#include <cwchar>
 
 #ifdef _WIN32
 
@@ -15,38 +17,162 @@ namespace dae::strings
 {
 auto get_line(const char* str, size_t max_search_size, char delim) -> std::string_view
 {
-    const char* endl = static_cast<const char*>(std::memchr(str, delim, max_search_size));
-    const size_t len = endl != nullptr ? static_cast<size_t>(endl - str) : max_search_size;
-    return {str, len};
+    return {str, kernels::get_kernels().find(str, max_search_size, delim)};
 }
 
 auto split(const char* buf, size_t size, char delim) -> std::vector<std::string_view> // NOLINT
 {
-    const char* front = buf;
-    const char* back = buf + size; // NOLINT
-    std::vector<std::string_view> svs;
-    while (front < back)
+    const kernels::KernelSet& kernel_set = kernels::get_kernels();
+
+    // Counting first is far cheaper than growing the vector over and over for buffers with many short pieces
+    std::vector<std::string_view> svs(kernel_set.count(buf, size, delim) + 1);
+    svs.resize(kernel_set.split(buf, size, delim, svs).count);
+    return svs;
+}
+
+auto split_into(const char* buf, size_t size, char delim, std::span<std::string_view> out) -> SplitResult
+{
+    return kernels::get_kernels().split(buf, size, delim, out);
+}
+
+namespace
+{
+// Strings shorter than one block of the vector kernels are checked inline, as a call through the kernel table would
+// only fall back to a scalar loop anyway
+constexpr size_t MIN_KERNEL_SIZE = 64;
+constexpr size_t INITIAL_PIECES = 64;
+
+/**
+ * @brief Splits a whole buffer into a vector with a `split_into()` style function, doubling the vector whenever it
+ * fills up, for the kernels that have no cheap way to count the pieces first.
+ */
+template <typename SplitInto>
+auto split_growing(const char* buf, size_t size, SplitInto&& split_into) -> std::vector<std::string_view>
+{
+    std::vector<std::string_view> svs(INITIAL_PIECES);
+    size_t count = 0;
+    size_t offset = 0;
+    while (true)
     {
-        std::string_view s = get_line(front, back - front, delim);
-        front += s.size() + 1; // NOLINT
-        svs.push_back(s);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const SplitResult result = split_into(buf + offset, size - offset, std::span(svs).subspan(count));
+        count += result.count;
+        offset += result.consumed;
+        if (offset == size)
+            break;
+        svs.resize(svs.size() * 2);
     }
+    svs.resize(count);
     return svs;
 }
 
-auto trim(std::string_view sv) -> std::string_view
+auto trim_with(const kernels::KernelSet& kernel_set, std::string_view sv) -> std::string_view
 {
-    static const char* space_characters = " \t\n\v\f\r";
-    size_t front = sv.find_first_not_of(space_characters);
-    if (front == std::string_view::npos)
+    // Most strings have nothing to trim
+    if (sv.empty() || (!kernels::is_whitespace(sv.front()) && !kernels::is_whitespace(sv.back())))
+        return sv;
+
+    size_t front = 0;
+    size_t back = sv.size();
+    if (sv.size() < MIN_KERNEL_SIZE)
+    {
+        while (front < back && kernels::is_whitespace(sv[front]))
+            front++;
+        while (back > front && kernels::is_whitespace(sv[back - 1]))
+            back--;
+    }
+    else
+    {
+        front = kernel_set.skip_whitespace(sv.data(), sv.size());
+        if (front == sv.size())
+            return {};
+        back = kernel_set.skip_whitespace_back(sv.data(), sv.size());
+    }
+    if (front == back)
         return {};
-    size_t back = sv.find_last_not_of(space_characters);
-    return sv.substr(front, back - front + 1);
+    return sv.substr(front, back - front);
+}
+} // namespace
+
+auto find(std::string_view str, std::string_view needle) -> std::optional<size_t>
+{
+    if (needle.size() > str.size())
+        return std::nullopt;
+    const kernels::KernelSet& kernel_set = kernels::get_kernels();
+    const size_t pos = needle.size() == 1 ? kernel_set.find(str.data(), str.size(), needle.front())
+                                          : kernel_set.find_substring(str.data(), str.size(), needle);
+    if (pos == str.size() && !needle.empty())
+        return std::nullopt;
+    return pos;
+}
+
+auto get_line(const char* str, size_t max_search_size, std::string_view delim) -> std::string_view
+{
+    if (delim.empty())
+        return {str, max_search_size};
+    if (delim.size() == 1)
+        return get_line(str, max_search_size, delim.front());
+    return {str, kernels::get_kernels().find_substring(str, max_search_size, delim)};
+}
+
+auto split(const char* buf, size_t size, std::string_view delim) -> std::vector<std::string_view> // NOLINT
+{
+    if (delim.size() == 1)
+        return split(buf, size, delim.front());
+    const kernels::KernelSet& kernel_set = kernels::get_kernels();
+    return split_growing(buf, size, [&](const char* rest, size_t rest_size, std::span<std::string_view> out) {
+        return kernel_set.split_substring(rest, rest_size, delim, out);
+    });
+}
+
+auto split_into(const char* buf, size_t size, std::string_view delim, std::span<std::string_view> out) -> SplitResult
+{
+    const kernels::KernelSet& kernel_set = kernels::get_kernels();
+    if (delim.size() == 1)
+        return kernel_set.split(buf, size, delim.front(), out);
+    return kernel_set.split_substring(buf, size, delim, out);
+}
+
+auto split_any(const char* buf, size_t size, std::string_view delims) -> std::vector<std::string_view> // NOLINT
+{
+    if (delims.size() == 1)
+        return split(buf, size, delims.front());
+    const kernels::KernelSet& kernel_set = kernels::get_kernels();
+    return split_growing(buf, size, [&](const char* rest, size_t rest_size, std::span<std::string_view> out) {
+        return kernel_set.split_any(rest, rest_size, delims, out);
+    });
+}
+
+auto split_any_into(const char* buf, size_t size, std::string_view delims, std::span<std::string_view> out)
+    -> SplitResult
+{
+    const kernels::KernelSet& kernel_set = kernels::get_kernels();
+    if (delims.size() == 1)
+        return kernel_set.split(buf, size, delims.front(), out);
+    return kernel_set.split_any(buf, size, delims, out);
+}
+
+auto trim(std::string_view sv) -> std::string_view
+{
+    return trim_with(kernels::get_kernels(), sv);
+}
+
+auto trim_all(std::span<std::string_view> svs) -> void
+{
+    const kernels::KernelSet& kernel_set = kernels::get_kernels();
+    for (std::string_view& sv : svs)
+    {
+        sv = trim_with(kernel_set, sv);
+    }
 }
 
 auto is_all_whitespace(const std::string_view sv) -> bool
 {
-    return std::ranges::all_of(sv, [](unsigned char c) -> int { return std::isspace(c); });
+    if (sv.size() < MIN_KERNEL_SIZE)
+    {
+        return std::ranges::all_of(sv, kernels::is_whitespace);
+    }
+    return kernels::get_kernels().skip_whitespace(sv.data(), sv.size()) == sv.size();
 }
 
 #if defined(_WIN32)
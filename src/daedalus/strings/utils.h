@@ -1,6 +1,8 @@
 #ifndef DAEDALUS_STRINGS_UTILS_H
 #define DAEDALUS_STRINGS_UTILS_H
 
+#include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -37,9 +39,123 @@ namespace dae::strings
  */
 [[nodiscard]] auto split(const char* buf, size_t size, char delim) -> std::vector<std::string_view>;
 
+/**
+ * @brief The outcome of a call to `split_into()`.
+ */
+struct SplitResult
+{
+    /**
+     * @brief The number of pieces written.
+     */
+    size_t count{0};
+    /**
+     * @brief The offset of the first piece that was not written, or the size of the buffer if every piece was.
+     */
+    size_t consumed{0};
+};
+
+/**
+ * @brief Splits a char buffer into caller provided storage, with the same rules as `split()`, without allocating.
+ *
+ * @note If `out` fills up before the end of the buffer, the split stops there. Calling it again with
+ * `buf + consumed` and `size - consumed` carries on with the next piece.
+ *
+ * @param buf A character buffer to split.
+ * @param size The size of the character buffer.
+ * @param delim The delimiter to split the character buffer with.
+ * @param out Where to write the string_views of the pieces.
+ *
+ * @return How many pieces were written, and how much of the buffer they covered.
+ */
+auto split_into(const char* buf, size_t size, char delim, std::span<std::string_view> out) -> SplitResult;
+
+/**
+ * @brief Finds the first occurrence of a substring, such as a multi-byte delimiter.
+ *
+ * @note Candidates are found 64 bytes at a time by matching the first and last bytes of the needle together, and the
+ * rest of the needle is only compared where both match.
+ *
+ * @param str The string to search.
+ * @param needle The substring to search for. An empty needle is found at 0.
+ *
+ * @return The index of the substring, or std::nullopt if it does not occur.
+ */
+[[nodiscard]] auto find(std::string_view str, std::string_view needle) -> std::optional<size_t>;
+
+/**
+ * @brief Returns the first line in a buffer, delineated by a multi-byte delimiter such as "\r\n", up to a maximum
+ * search size. Works like the single character `get_line()`, but the next line starts `delim.size()` bytes after the
+ * end of the returned one.
+ *
+ * @param str The string buffer to search.
+ * @param max_search_size The most characters that can be searched for the delimiter.
+ * @param delim The delimiter to search for to delineate the string.
+ *
+ * @return A std::string_view of the first line encountered.
+ */
+[[nodiscard]] auto get_line(const char* str, size_t max_search_size, std::string_view delim) -> std::string_view;
+
+/**
+ * @brief Splits a char buffer into a vector of string_views on a multi-byte delimiter, such as "\r\n" or "||".
+ *
+ * @note Follows the same rules as the single character `split()`. Occurrences of the delimiter are matched from left
+ * to right and never overlap, and an empty delimiter never matches.
+ *
+ * @param buf A character buffer to split.
+ * @param size The size of the character buffer.
+ * @param delim The delimiter to split the character buffer with.
+ *
+ * @return A vector of string_views based on buf.
+ */
+[[nodiscard]] auto split(const char* buf, size_t size, std::string_view delim) -> std::vector<std::string_view>;
+
+/**
+ * @brief Splits a char buffer on a multi-byte delimiter into caller provided storage, with the same rules as
+ * `split_into()` and the multi-byte `split()`.
+ *
+ * @param buf A character buffer to split.
+ * @param size The size of the character buffer.
+ * @param delim The delimiter to split the character buffer with.
+ * @param out Where to write the string_views of the pieces.
+ *
+ * @return How many pieces were written, and how much of the buffer they covered.
+ */
+auto split_into(const char* buf, size_t size, std::string_view delim, std::span<std::string_view> out) -> SplitResult;
+
+/**
+ * @brief Splits a char buffer into a vector of string_views on any of a set of characters, in one pass.
+ *
+ * @note Follows the same rules as `split()`, with every occurrence of any of the characters closing a piece. Each
+ * character in the set adds one comparison per byte, so small sets are the fastest.
+ *
+ * @param buf A character buffer to split.
+ * @param size The size of the character buffer.
+ * @param delims The characters to split the character buffer on.
+ *
+ * @return A vector of string_views based on buf.
+ */
+[[nodiscard]] auto split_any(const char* buf, size_t size, std::string_view delims) -> std::vector<std::string_view>;
+
+/**
+ * @brief Splits a char buffer on any of a set of characters into caller provided storage, with the same rules as
+ * `split_into()` and `split_any()`.
+ *
+ * @param buf A character buffer to split.
+ * @param size The size of the character buffer.
+ * @param delims The characters to split the character buffer on.
+ * @param out Where to write the string_views of the pieces.
+ *
+ * @return How many pieces were written, and how much of the buffer they covered.
+ */
+auto split_any_into(const char* buf, size_t size, std::string_view delims, std::span<std::string_view> out)
+    -> SplitResult;
+
 /**
  * @brief Removes the whitespace from the front and back of a string_view.
  *
+ * @note Whitespace is the ASCII set ' ', '\t', '\n', '\v', '\f', and '\r', whatever the locale. Long runs of it
+ * are skipped with the vector kernels in `daedalus/strings/kernels.h`.
+ *
  * @param sv The string view to trim whitespace from.
  *
  * @return A string_view of the passed in string without whitespace in the front or back.
@@ -47,7 +163,16 @@ namespace dae::strings
 [[nodiscard]] auto trim(std::string_view sv) -> std::string_view;
 
 /**
- * @brief Checks if a string is entirely whitespace.
+ * @brief Trims every string_view in a span in place, with the same rules as `trim()`.
+ *
+ * @note Cheaper than calling `trim()` on each one, as the kernels are only looked up once.
+ *
+ * @param svs The string views to trim, such as the pieces from `split()`.
+ */
+auto trim_all(std::span<std::string_view> svs) -> void;
+
+/**
+ * @brief Checks if a string is entirely whitespace, with the same whitespace characters as `trim()`.
  *
  * @param sv The string view to check for whitespace.
  *
@@ -0,0 +1,155 @@
+/**
+ * @brief Loads a few thousand temp files through AsyncReadEngine, with io_uring and with the fallback thread pool, and
+ * checks that every read completes with every byte of its file.
+ *
+ * Exits with a non-zero status on the first mismatch.
+ */
+
+#include "daedalus/platform/linux/io/async_read.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace
+{
+using dae::io::AsyncRead;
+using dae::io::AsyncReadEngine;
+
+constexpr uint32_t FILE_COUNT = 3000;
+constexpr size_t MAX_FILE_SIZE = 8192;
+
+/**
+ * @brief The contents of every test file are derived from its index, so they can be checked without keeping a copy.
+ */
+auto expected_byte(uint32_t file, size_t offset) -> char
+{
+    return static_cast<char>((file * 31) + (offset * 7) + (offset >> 8));
+}
+
+/**
+ * @brief File sizes cover empty files, sizes around a page, and sizes that are not a multiple of anything.
+ */
+auto file_size(uint32_t file) -> size_t
+{
+    return (static_cast<size_t>(file) * 2654435761U) % (MAX_FILE_SIZE + 1);
+}
+
+auto write_files(const std::filesystem::path& directory) -> bool
+{
+    std::filesystem::create_directories(directory);
+    for (uint32_t i = 0; i < FILE_COUNT; i++)
+    {
+        std::vector<char> contents(file_size(i));
+        for (size_t j = 0; j < contents.size(); j++)
+        {
+            contents[j] = expected_byte(i, j);
+        }
+
+        std::ofstream out(directory / std::to_string(i), std::ios::binary);
+        out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+        if (!out)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Reads every file through the engine in one batch and checks each completion.
+ *
+ * @return The number of failed checks.
+ */
+auto run(AsyncReadEngine& engine, const std::filesystem::path& directory) -> uint32_t
+{
+    std::vector<int> fds(FILE_COUNT, -1);
+    std::vector<std::vector<char>> buffers(FILE_COUNT);
+    std::vector<std::shared_ptr<AsyncRead>> reads;
+    reads.reserve(FILE_COUNT);
+
+    for (uint32_t i = 0; i < FILE_COUNT; i++)
+    {
+        fds[i] = open((directory / std::to_string(i)).c_str(), O_RDONLY | O_CLOEXEC); // NOLINT
+        if (fds[i] < 0)
+        {
+            std::fprintf(stderr, "failed to open file %u\n", i);
+            return FILE_COUNT;
+        }
+        // One spare byte, so that a read past the end of the file would be caught.
+        buffers[i].resize(file_size(i) + 1);
+        reads.push_back(std::make_shared<AsyncRead>(fds[i], buffers[i].data(), buffers[i].size(), 0, 1));
+    }
+
+    engine.submit(reads);
+
+    uint32_t failures = 0;
+    for (uint32_t i = 0; i < FILE_COUNT; i++)
+    {
+        std::optional<size_t> bytes_read = reads[i]->wait();
+        if (!reads[i]->is_done() || !bytes_read)
+        {
+            std::fprintf(stderr, "read of file %u failed\n", i);
+            failures++;
+        }
+        else if (bytes_read.value() != file_size(i))
+        {
+            std::fprintf(stderr, "read of file %u returned %zu bytes, expected %zu\n", i, *bytes_read, file_size(i));
+            failures++;
+        }
+        else
+        {
+            for (size_t j = 0; j < file_size(i); j++)
+            {
+                if (buffers[i][j] != expected_byte(i, j))
+                {
+                    std::fprintf(stderr, "file %u differs at byte %zu\n", i, j);
+                    failures++;
+                    break;
+                }
+            }
+        }
+        close(fds[i]);
+    }
+    return failures;
+}
+} // namespace
+
+auto main() -> int
+{
+    const std::filesystem::path directory =
+        std::filesystem::temp_directory_path() / ("daedalus_async_read_test_" + std::to_string(getpid()));
+    if (!write_files(directory))
+    {
+        std::fprintf(stderr, "failed to write test files to %s\n", directory.c_str());
+        return 1;
+    }
+
+    uint32_t failures = 0;
+    {
+        AsyncReadEngine engine(true);
+        std::fprintf(stderr, "io_uring engine (uses io_uring: %d)\n", engine.uses_io_uring() ? 1 : 0);
+        failures += run(engine, directory);
+    }
+    {
+        AsyncReadEngine engine(false);
+        std::fprintf(stderr, "thread pool engine\n");
+        failures += run(engine, directory);
+    }
+
+    std::filesystem::remove_all(directory);
+
+    if (failures != 0)
+    {
+        std::fprintf(stderr, "%u failures\n", failures);
+        return 1;
+    }
+    return 0;
+}
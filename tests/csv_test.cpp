@@ -0,0 +1,105 @@
+/**
+ * @brief Checks CsvTokenizer against records that straddle chunks, quoted fields, and feeds made before a chunk has
+ * been fully read.
+ *
+ * Exits with a non-zero status if any check fails.
+ */
+
+#include "daedalus/strings/csv.h"
+
+#include <cstdio>
+#include <initializer_list>
+#include <optional>
+#include <string_view>
+
+namespace
+{
+using dae::strings::CsvRecord;
+using dae::strings::CsvTokenizer;
+
+int failures = 0;
+
+auto check(bool condition, const char* what) -> void
+{
+    if (!condition)
+    {
+        std::fprintf(stderr, "failed: %s\n", what);
+        failures++;
+    }
+}
+
+auto matches(std::optional<CsvRecord> record, std::initializer_list<std::string_view> expected) -> bool
+{
+    if (!record || record->size() != expected.size())
+    {
+        return false;
+    }
+    size_t i = 0;
+    for (std::string_view field : expected)
+    {
+        if ((*record)[i++] != field)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+auto test_whole_buffer() -> void
+{
+    CsvTokenizer tokenizer;
+    check(tokenizer.feed(std::string_view("a,b,c\n1,\"x,\"\"y\"\"\",3\r\n")), "feed whole buffer");
+    check(matches(tokenizer.next(), {"a", "b", "c"}), "first record");
+    check(matches(tokenizer.next(), {"1", "x,\"y\"", "3"}), "quoted record");
+    check(!tokenizer.next(), "end of buffer");
+}
+
+auto test_straddling_record() -> void
+{
+    CsvTokenizer tokenizer;
+    check(tokenizer.feed(std::string_view("a,b\ncd")), "feed first chunk");
+    check(matches(tokenizer.next(), {"a", "b"}), "record before the split");
+    check(!tokenizer.next(), "first chunk used up");
+    check(tokenizer.feed(std::string_view("e,f\n")), "feed second chunk");
+    check(matches(tokenizer.next(), {"cde", "f"}), "record across the split");
+    check(!tokenizer.next(), "second chunk used up");
+}
+
+auto test_feed_before_tail_is_read() -> void
+{
+    // The tail "cd" is only carried once next() runs out, so feeding before then would lose it.
+    CsvTokenizer tokenizer;
+    check(tokenizer.feed(std::string_view("a,b\ncd")), "feed first chunk");
+    check(matches(tokenizer.next(), {"a", "b"}), "record before the tail");
+    check(!tokenizer.feed(std::string_view("e\n")), "feed refused while the tail is unread");
+    check(!tokenizer.next(), "first chunk used up");
+    check(tokenizer.feed(std::string_view("e\n")), "feed accepted once the tail is carried");
+    check(matches(tokenizer.next(), {"cde"}), "tail kept");
+}
+
+auto test_finish() -> void
+{
+    CsvTokenizer tokenizer;
+    check(tokenizer.feed(std::string_view("x\ny,z")), "feed");
+    check(matches(tokenizer.next(), {"x"}), "first record");
+    check(!tokenizer.next(), "last record held back");
+    tokenizer.finish();
+    check(matches(tokenizer.next(), {"y", "z"}), "last record without a newline");
+    check(!tokenizer.next(), "end after finish");
+}
+} // namespace
+
+auto main() -> int
+{
+    test_whole_buffer();
+    test_straddling_record();
+    test_feed_before_tail_is_read();
+    test_finish();
+
+    if (failures != 0)
+    {
+        std::fprintf(stderr, "%d failures\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,166 @@
+/**
+ * @brief Checks that every FileLoadStrategy agrees on edge cases of loading and saving files.
+ *
+ * Exits with a non-zero status if any check fails.
+ */
+
+#include "daedalus/io/file.h"
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace
+{
+using dae::io::File;
+using dae::io::FileLoadStrategy;
+
+constexpr FileLoadStrategy STRATEGIES[] = {
+    FileLoadStrategy::StdLibrary,
+    FileLoadStrategy::AllowCached,
+    FileLoadStrategy::SafeDirectDisk,
+    FileLoadStrategy::Mapped,
+};
+
+int failures = 0;
+
+auto check(bool condition, const char* what, FileLoadStrategy strategy) -> void
+{
+    if (!condition)
+    {
+        std::fprintf(stderr, "failed: %s (strategy %d)\n", what, static_cast<int>(strategy));
+        failures++;
+    }
+}
+
+auto write_file(const std::filesystem::path& path, const std::string& contents) -> void
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+auto test_empty_file(const std::filesystem::path& directory) -> void
+{
+    const std::string path = (directory / "empty").string();
+    write_file(path, "");
+
+    // StdLibrary has always rejected empty files, so only the strategies that read through the OS are checked
+    for (FileLoadStrategy strategy : STRATEGIES)
+    {
+        if (strategy == FileLoadStrategy::StdLibrary)
+        {
+            continue;
+        }
+        std::optional<File> file = dae::io::load_file(path, strategy);
+        check(file.has_value(), "empty file loads", strategy);
+        if (file)
+        {
+            check(dae::io::get_file_data(file.value()).empty(), "empty file has no data", strategy);
+            dae::io::free_file(file.value());
+        }
+    }
+}
+
+auto test_empty_ranges(const std::filesystem::path& directory) -> void
+{
+    const std::string path = (directory / "ranges").string();
+    write_file(path, "0123456789");
+
+    const dae::io::FileRange ranges[] = {
+        {.offset = 3, .length = 0},
+        {.offset = 10, .length = 4},
+        {.offset = 64, .length = 4},
+        {.offset = 8, .length = 100},
+    };
+    constexpr size_t EXPECTED_SIZES[] = {0, 0, 0, 2};
+
+    for (FileLoadStrategy strategy : STRATEGIES)
+    {
+        std::vector<std::optional<File>> files = dae::io::load_file_ranges(path, ranges, strategy);
+        for (size_t i = 0; i < files.size(); i++)
+        {
+            check(files[i].has_value(), "range loads", strategy);
+            if (files[i])
+            {
+                check(dae::io::get_file_data(files[i].value()).size() == EXPECTED_SIZES[i], "range size", strategy);
+                dae::io::free_file(files[i].value());
+            }
+        }
+
+        std::optional<File> file = dae::io::load_file_range(path, 0, 0, strategy);
+        check(file.has_value(), "zero length range loads", strategy);
+        if (file)
+        {
+            check(dae::io::get_file_data(file.value()).empty(), "zero length range is empty", strategy);
+            dae::io::free_file(file.value());
+        }
+    }
+}
+
+#ifndef _WIN32
+auto test_atomic_replace_keeps_permissions(const std::filesystem::path& directory) -> void
+{
+    const std::string path = (directory / "secret").string();
+    const std::string contents = "hunter2";
+    const std::span<const std::byte> data(reinterpret_cast<const std::byte*>(contents.data()), // NOLINT
+                                          contents.size());
+
+    // Mapped is not supported for saving
+    for (FileLoadStrategy strategy : STRATEGIES)
+    {
+        if (strategy == FileLoadStrategy::Mapped)
+        {
+            continue;
+        }
+
+        write_file(path, "old");
+        chmod(path.c_str(), 0600);
+
+        const dae::io::FileSaveOptions options{.save_strategy = strategy, .atomic_replace = true};
+        check(dae::io::save_file(path, data, options), "atomic save succeeds", strategy);
+
+        struct stat saved{};
+        check(stat(path.c_str(), &saved) == 0 && (saved.st_mode & 07777) == 0600,
+              "atomic save keeps the destination's 0600 mode",
+              strategy);
+
+        std::optional<File> file = dae::io::load_file(path, FileLoadStrategy::AllowCached);
+        check(file && dae::io::get_file_data(file.value()).size() == contents.size(), "saved file reads back", strategy);
+        if (file)
+        {
+            dae::io::free_file(file.value());
+        }
+    }
+}
+#endif
+} // namespace
+
+auto main() -> int
+{
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "daedalus_file_test";
+    std::filesystem::create_directories(directory);
+
+    test_empty_file(directory);
+    test_empty_ranges(directory);
+#ifndef _WIN32
+    test_atomic_replace_keeps_permissions(directory);
+#endif
+
+    std::filesystem::remove_all(directory);
+
+    if (failures != 0)
+    {
+        std::fprintf(stderr, "%d failures\n", failures);
+        return 1;
+    }
+    return 0;
+}